@@ -0,0 +1,395 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPCONSTEXPRHASH_H
+#define HLPCONSTEXPRHASH_H
+
+#include <cstddef>
+#include <cstdint>
+
+
+/// <summary>
+/// Compile time versions of the simple 32 and 64 bit hashes, giving the
+/// same value as "ComputeString(...)->GetUInt32()" (or GetUInt64()) of the
+/// runtime class, so string keys can be hashed into "case" labels or table
+/// indices. Passing a string literal hashes it without its terminator;
+/// a key other than the default one goes with an explicit length.
+/// Written as C++11 constexpr functions, i.e. one recursion level per byte
+/// (per stripe for XXHash), so the compiler's constexpr depth limit, 512 by
+/// default on GCC, Clang and MSVC, bounds the key length at compile time.
+/// Long or runtime inputs belong in the runtime classes.
+/// </summary>
+class ConstexprHash
+{
+public:
+	// Hash32
+
+	static constexpr uint32_t FNV(const char *a_data, const size_t a_length)
+	{
+		return FNVStep(a_data, a_length, 0);
+	} // end function FNV
+
+	template <size_t N>
+	static constexpr uint32_t FNV(const char (&a_data)[N])
+	{
+		return FNV(a_data, N - 1);
+	} // end function FNV
+
+	static constexpr uint32_t FNV1a(const char *a_data, const size_t a_length)
+	{
+		return FNV1aStep(a_data, a_length, 2166136261);
+	} // end function FNV1a
+
+	template <size_t N>
+	static constexpr uint32_t FNV1a(const char (&a_data)[N])
+	{
+		return FNV1a(a_data, N - 1);
+	} // end function FNV1a
+
+	static constexpr uint32_t DJB(const char *a_data, const size_t a_length)
+	{
+		return DJBStep(a_data, a_length, 5381);
+	} // end function DJB
+
+	template <size_t N>
+	static constexpr uint32_t DJB(const char (&a_data)[N])
+	{
+		return DJB(a_data, N - 1);
+	} // end function DJB
+
+	static constexpr uint32_t SDBM(const char *a_data, const size_t a_length)
+	{
+		return SDBMStep(a_data, a_length, 0);
+	} // end function SDBM
+
+	template <size_t N>
+	static constexpr uint32_t SDBM(const char (&a_data)[N])
+	{
+		return SDBM(a_data, N - 1);
+	} // end function SDBM
+
+	static constexpr uint32_t MurmurHash3_x86_32(const char *a_data, const size_t a_length,
+		const uint32_t a_key = 0)
+	{
+		return Murmur3Final(Murmur3Tail(a_data + (a_length & ~size_t(3)), a_length & 3,
+			Murmur3Body(a_data, a_length >> 2, a_key)) ^ uint32_t(a_length));
+	} // end function MurmurHash3_x86_32
+
+	template <size_t N>
+	static constexpr uint32_t MurmurHash3_x86_32(const char (&a_data)[N])
+	{
+		return MurmurHash3_x86_32(a_data, N - 1);
+	} // end function MurmurHash3_x86_32
+
+	static constexpr uint32_t XXHash32(const char *a_data, const size_t a_length,
+		const uint32_t a_key = 0)
+	{
+		return XXH32Avalanche(XXH32Tail(a_data + (a_length & ~size_t(15)), a_length & 15,
+			(a_length >= 16 ? XXH32Stripes(a_data, a_length >> 4, a_key + PRIME32_1 + PRIME32_2,
+				a_key + PRIME32_2, a_key, a_key - PRIME32_1) : a_key + PRIME32_5)
+			+ uint32_t(a_length)));
+	} // end function XXHash32
+
+	template <size_t N>
+	static constexpr uint32_t XXHash32(const char (&a_data)[N])
+	{
+		return XXHash32(a_data, N - 1);
+	} // end function XXHash32
+
+	// Checksum
+
+	// Any 32 bit CRC, parameters as in "Checksum::CreateCRC32".
+	static constexpr uint32_t CRC32(const char *a_data, const size_t a_length, const uint32_t a_poly,
+		const uint32_t a_init, const bool a_refIn, const bool a_refOut, const uint32_t a_xorOut)
+	{
+		return (a_refOut ? Reflect(CRC32Step(a_data, a_length, a_poly, a_init, a_refIn), 32)
+			: CRC32Step(a_data, a_length, a_poly, a_init, a_refIn)) ^ a_xorOut;
+	} // end function CRC32
+
+	template <size_t N>
+	static constexpr uint32_t CRC32(const char (&a_data)[N], const uint32_t a_poly,
+		const uint32_t a_init, const bool a_refIn, const bool a_refOut, const uint32_t a_xorOut)
+	{
+		return CRC32(a_data, N - 1, a_poly, a_init, a_refIn, a_refOut, a_xorOut);
+	} // end function CRC32
+
+	static constexpr uint32_t CRC32_PKZIP(const char *a_data, const size_t a_length)
+	{
+		return CRC32(a_data, a_length, 0x04C11DB7, 0xFFFFFFFF, true, true, 0xFFFFFFFF);
+	} // end function CRC32_PKZIP
+
+	template <size_t N>
+	static constexpr uint32_t CRC32_PKZIP(const char (&a_data)[N])
+	{
+		return CRC32_PKZIP(a_data, N - 1);
+	} // end function CRC32_PKZIP
+
+	static constexpr uint32_t CRC32_CASTAGNOLI(const char *a_data, const size_t a_length)
+	{
+		return CRC32(a_data, a_length, 0x1EDC6F41, 0xFFFFFFFF, true, true, 0xFFFFFFFF);
+	} // end function CRC32_CASTAGNOLI
+
+	template <size_t N>
+	static constexpr uint32_t CRC32_CASTAGNOLI(const char (&a_data)[N])
+	{
+		return CRC32_CASTAGNOLI(a_data, N - 1);
+	} // end function CRC32_CASTAGNOLI
+
+	// Hash64
+
+	static constexpr uint64_t FNV64(const char *a_data, const size_t a_length)
+	{
+		return FNV64Step(a_data, a_length, 0);
+	} // end function FNV64
+
+	template <size_t N>
+	static constexpr uint64_t FNV64(const char (&a_data)[N])
+	{
+		return FNV64(a_data, N - 1);
+	} // end function FNV64
+
+	static constexpr uint64_t FNV1a64(const char *a_data, const size_t a_length)
+	{
+		return FNV1a64Step(a_data, a_length, 14695981039346656037ULL);
+	} // end function FNV1a64
+
+	template <size_t N>
+	static constexpr uint64_t FNV1a64(const char (&a_data)[N])
+	{
+		return FNV1a64(a_data, N - 1);
+	} // end function FNV1a64
+
+	static constexpr uint64_t XXHash64(const char *a_data, const size_t a_length,
+		const uint64_t a_key = 0)
+	{
+		return XXH64Avalanche(XXH64Tail(a_data + (a_length & ~size_t(31)), a_length & 31,
+			(a_length >= 32 ? XXH64Stripes(a_data, a_length >> 5, a_key + PRIME64_1 + PRIME64_2,
+				a_key + PRIME64_2, a_key, a_key - PRIME64_1) : a_key + PRIME64_5)
+			+ uint64_t(a_length)));
+	} // end function XXHash64
+
+	template <size_t N>
+	static constexpr uint64_t XXHash64(const char (&a_data)[N])
+	{
+		return XXHash64(a_data, N - 1);
+	} // end function XXHash64
+
+private:
+	static constexpr uint32_t Byte(const char *a_data, const size_t a_index)
+	{
+		return uint32_t(uint8_t(a_data[a_index]));
+	} // end function Byte
+
+	static constexpr uint32_t ReadUInt32LE(const char *a_data)
+	{
+		return Byte(a_data, 0) | (Byte(a_data, 1) << 8) | (Byte(a_data, 2) << 16) | (Byte(a_data, 3) << 24);
+	} // end function ReadUInt32LE
+
+	static constexpr uint64_t ReadUInt64LE(const char *a_data)
+	{
+		return uint64_t(ReadUInt32LE(a_data)) | (uint64_t(ReadUInt32LE(a_data + 4)) << 32);
+	} // end function ReadUInt64LE
+
+	static constexpr uint32_t RotateLeft32(const uint32_t a_value, const int32_t a_distance)
+	{
+		return (a_value << a_distance) | (a_value >> (32 - a_distance));
+	} // end function RotateLeft32
+
+	static constexpr uint64_t RotateLeft64(const uint64_t a_value, const int32_t a_distance)
+	{
+		return (a_value << a_distance) | (a_value >> (64 - a_distance));
+	} // end function RotateLeft64
+
+	static constexpr uint32_t Reflect(const uint32_t a_value, const int32_t a_width)
+	{
+		return a_width == 0 ? 0 : ((a_value & 1) << (a_width - 1)) | Reflect(a_value >> 1, a_width - 1);
+	} // end function Reflect
+
+	static constexpr uint32_t FNVStep(const char *a_data, const size_t a_length, const uint32_t a_hash)
+	{
+		return a_length == 0 ? a_hash
+			: FNVStep(a_data + 1, a_length - 1, (a_hash * 16777619) ^ Byte(a_data, 0));
+	} // end function FNVStep
+
+	static constexpr uint32_t FNV1aStep(const char *a_data, const size_t a_length, const uint32_t a_hash)
+	{
+		return a_length == 0 ? a_hash
+			: FNV1aStep(a_data + 1, a_length - 1, (a_hash ^ Byte(a_data, 0)) * 16777619);
+	} // end function FNV1aStep
+
+	static constexpr uint32_t DJBStep(const char *a_data, const size_t a_length, const uint32_t a_hash)
+	{
+		return a_length == 0 ? a_hash
+			: DJBStep(a_data + 1, a_length - 1, ((a_hash << 5) + a_hash) + Byte(a_data, 0));
+	} // end function DJBStep
+
+	static constexpr uint32_t SDBMStep(const char *a_data, const size_t a_length, const uint32_t a_hash)
+	{
+		return a_length == 0 ? a_hash
+			: SDBMStep(a_data + 1, a_length - 1, Byte(a_data, 0) + (a_hash << 6) + (a_hash << 16) - a_hash);
+	} // end function SDBMStep
+
+	static constexpr uint64_t FNV64Step(const char *a_data, const size_t a_length, const uint64_t a_hash)
+	{
+		return a_length == 0 ? a_hash
+			: FNV64Step(a_data + 1, a_length - 1, (a_hash * 1099511628211ULL) ^ Byte(a_data, 0));
+	} // end function FNV64Step
+
+	static constexpr uint64_t FNV1a64Step(const char *a_data, const size_t a_length, const uint64_t a_hash)
+	{
+		return a_length == 0 ? a_hash
+			: FNV1a64Step(a_data + 1, a_length - 1, (a_hash ^ Byte(a_data, 0)) * 1099511628211ULL);
+	} // end function FNV1a64Step
+
+	static constexpr uint32_t Murmur3Mix(const uint32_t a_k)
+	{
+		return RotateLeft32(a_k * MURMUR3_C1, 15) * MURMUR3_C2;
+	} // end function Murmur3Mix
+
+	static constexpr uint32_t Murmur3Body(const char *a_data, const size_t a_blocks, const uint32_t a_h)
+	{
+		return a_blocks == 0 ? a_h
+			: Murmur3Body(a_data + 4, a_blocks - 1,
+				RotateLeft32(a_h ^ Murmur3Mix(ReadUInt32LE(a_data)), 13) * 5 + MURMUR3_C3);
+	} // end function Murmur3Body
+
+	static constexpr uint32_t Murmur3Tail(const char *a_data, const size_t a_length, const uint32_t a_h)
+	{
+		return a_length == 0 ? a_h
+			: a_h ^ Murmur3Mix((a_length >= 3 ? Byte(a_data, 2) << 16 : 0)
+				^ (a_length >= 2 ? Byte(a_data, 1) << 8 : 0) ^ Byte(a_data, 0));
+	} // end function Murmur3Tail
+
+	static constexpr uint32_t Murmur3Final(const uint32_t a_h)
+	{
+		return Murmur3Shift(Murmur3Shift(Murmur3Shift(a_h, 16) * MURMUR3_C4, 13) * MURMUR3_C5, 16);
+	} // end function Murmur3Final
+
+	static constexpr uint32_t Murmur3Shift(const uint32_t a_h, const int32_t a_distance)
+	{
+		return a_h ^ (a_h >> a_distance);
+	} // end function Murmur3Shift
+
+	static constexpr uint32_t XXH32Round(const uint32_t a_v, const char *a_data)
+	{
+		return PRIME32_1 * RotateLeft32(a_v + PRIME32_2 * ReadUInt32LE(a_data), 13);
+	} // end function XXH32Round
+
+	static constexpr uint32_t XXH32Stripes(const char *a_data, const size_t a_stripes,
+		const uint32_t a_v1, const uint32_t a_v2, const uint32_t a_v3, const uint32_t a_v4)
+	{
+		return a_stripes == 0
+			? RotateLeft32(a_v1, 1) + RotateLeft32(a_v2, 7) + RotateLeft32(a_v3, 12) + RotateLeft32(a_v4, 18)
+			: XXH32Stripes(a_data + 16, a_stripes - 1, XXH32Round(a_v1, a_data),
+				XXH32Round(a_v2, a_data + 4), XXH32Round(a_v3, a_data + 8), XXH32Round(a_v4, a_data + 12));
+	} // end function XXH32Stripes
+
+	static constexpr uint32_t XXH32Tail(const char *a_data, const size_t a_length, const uint32_t a_hash)
+	{
+		return a_length >= 4
+			? XXH32Tail(a_data + 4, a_length - 4,
+				RotateLeft32(a_hash + ReadUInt32LE(a_data) * PRIME32_3, 17) * PRIME32_4)
+			: a_length == 0 ? a_hash
+			: XXH32Tail(a_data + 1, a_length - 1,
+				RotateLeft32(a_hash + Byte(a_data, 0) * PRIME32_5, 11) * PRIME32_1);
+	} // end function XXH32Tail
+
+	static constexpr uint32_t XXH32Avalanche(const uint32_t a_hash)
+	{
+		return Murmur3Shift(Murmur3Shift(Murmur3Shift(a_hash, 15) * PRIME32_2, 13) * PRIME32_3, 16);
+	} // end function XXH32Avalanche
+
+	static constexpr uint64_t XXH64Round(const uint64_t a_v, const uint64_t a_input)
+	{
+		return PRIME64_1 * RotateLeft64(a_v + PRIME64_2 * a_input, 31);
+	} // end function XXH64Round
+
+	static constexpr uint64_t XXH64Merge(const uint64_t a_hash, const uint64_t a_v)
+	{
+		return (a_hash ^ XXH64Round(0, a_v)) * PRIME64_1 + PRIME64_4;
+	} // end function XXH64Merge
+
+	static constexpr uint64_t XXH64Stripes(const char *a_data, const size_t a_stripes,
+		const uint64_t a_v1, const uint64_t a_v2, const uint64_t a_v3, const uint64_t a_v4)
+	{
+		return a_stripes == 0
+			? XXH64Merge(XXH64Merge(XXH64Merge(XXH64Merge(RotateLeft64(a_v1, 1) + RotateLeft64(a_v2, 7)
+				+ RotateLeft64(a_v3, 12) + RotateLeft64(a_v4, 18), a_v1), a_v2), a_v3), a_v4)
+			: XXH64Stripes(a_data + 32, a_stripes - 1, XXH64Round(a_v1, ReadUInt64LE(a_data)),
+				XXH64Round(a_v2, ReadUInt64LE(a_data + 8)), XXH64Round(a_v3, ReadUInt64LE(a_data + 16)),
+				XXH64Round(a_v4, ReadUInt64LE(a_data + 24)));
+	} // end function XXH64Stripes
+
+	static constexpr uint64_t XXH64Tail(const char *a_data, const size_t a_length, const uint64_t a_hash)
+	{
+		return a_length >= 8
+			? XXH64Tail(a_data + 8, a_length - 8,
+				RotateLeft64(a_hash ^ XXH64Round(0, ReadUInt64LE(a_data)), 27) * PRIME64_1 + PRIME64_4)
+			: a_length >= 4
+			? XXH64Tail(a_data + 4, a_length - 4,
+				RotateLeft64(a_hash ^ (uint64_t(ReadUInt32LE(a_data)) * PRIME64_1), 23) * PRIME64_2 + PRIME64_3)
+			: a_length == 0 ? a_hash
+			: XXH64Tail(a_data + 1, a_length - 1,
+				RotateLeft64(a_hash ^ (Byte(a_data, 0) * PRIME64_5), 11) * PRIME64_1);
+	} // end function XXH64Tail
+
+	static constexpr uint64_t XXH64Shift(const uint64_t a_hash, const int32_t a_distance)
+	{
+		return a_hash ^ (a_hash >> a_distance);
+	} // end function XXH64Shift
+
+	static constexpr uint64_t XXH64Avalanche(const uint64_t a_hash)
+	{
+		return XXH64Shift(XXH64Shift(XXH64Shift(a_hash, 33) * PRIME64_2, 29) * PRIME64_3, 32);
+	} // end function XXH64Avalanche
+
+	// Bitwise, most significant bit first; reflected input is mirrored per byte.
+	static constexpr uint32_t CRC32Bits(const uint32_t a_crc, const uint32_t a_poly, const int32_t a_bits)
+	{
+		return a_bits == 0 ? a_crc
+			: CRC32Bits((a_crc & 0x80000000) != 0 ? (a_crc << 1) ^ a_poly : a_crc << 1, a_poly, a_bits - 1);
+	} // end function CRC32Bits
+
+	static constexpr uint32_t CRC32Step(const char *a_data, const size_t a_length, const uint32_t a_poly,
+		const uint32_t a_crc, const bool a_refIn)
+	{
+		return a_length == 0 ? a_crc
+			: CRC32Step(a_data + 1, a_length - 1, a_poly,
+				CRC32Bits(a_crc ^ ((a_refIn ? Reflect(Byte(a_data, 0), 8) : Byte(a_data, 0)) << 24), a_poly, 8),
+				a_refIn);
+	} // end function CRC32Step
+
+	static const uint32_t MURMUR3_C1 = uint32_t(0xCC9E2D51);
+	static const uint32_t MURMUR3_C2 = uint32_t(0x1B873593);
+	static const uint32_t MURMUR3_C3 = uint32_t(0xE6546B64);
+	static const uint32_t MURMUR3_C4 = uint32_t(0x85EBCA6B);
+	static const uint32_t MURMUR3_C5 = uint32_t(0xC2B2AE35);
+
+	static const uint32_t PRIME32_1 = uint32_t(2654435761);
+	static const uint32_t PRIME32_2 = uint32_t(2246822519);
+	static const uint32_t PRIME32_3 = uint32_t(3266489917);
+	static const uint32_t PRIME32_4 = uint32_t(668265263);
+	static const uint32_t PRIME32_5 = uint32_t(374761393);
+
+	static const uint64_t PRIME64_1 = uint64_t(11400714785074694791ULL);
+	static const uint64_t PRIME64_2 = uint64_t(14029467366897019727ULL);
+	static const uint64_t PRIME64_3 = uint64_t(1609587929392839161ULL);
+	static const uint64_t PRIME64_4 = uint64_t(9650029242287828579ULL);
+	static const uint64_t PRIME64_5 = uint64_t(2870177450012600261ULL);
+
+}; // end class ConstexprHash
+
+
+#endif // !HLPCONSTEXPRHASH_H
@@ -212,13 +212,13 @@ public:
 		} // end else
 	} // end function le64_copy
 	
-	inline static uint32_t ReadBytesAsUInt32LE(const uint8_t *a_in, const int32_t a_index)
+	inline static uint32_t ReadBytesAsUInt32LE(const uint8_t *a_in, const int64_t a_index)
 	{
 		uint32_t result = *(uint32_t *)(a_in + a_index);
 		return Converters::le2me_32(result);
 	} // end function ReadBytesAsUInt32LE
 	
-	inline static uint64_t ReadBytesAsUInt64LE(const uint8_t *a_in, const int32_t a_index)
+	inline static uint64_t ReadBytesAsUInt64LE(const uint8_t *a_in, const int64_t a_index)
 	{
 		uint64_t result = *(uint64_t *)(a_in + a_index);
 		return Converters::le2me_64(result);
@@ -262,6 +262,12 @@ public:
 		a_out[a_index + 7] = (uint8_t)(a_in >> 56);
 	} // end function ReadUInt64AsBytesLE
 
+	inline static void ReadUInt64AsBytesLE(const uint64_t a_in, uint8_t *a_out, const int32_t a_index)
+	{
+		for (register int32_t i = 0; i < 8; i++)
+			a_out[a_index + i] = (uint8_t)(a_in >> (i * 8));
+	} // end function ReadUInt64AsBytesLE
+
 	inline static void ReadUInt64AsBytesBE(const uint64_t a_in, HashLibByteArray &a_out, const int32_t a_index)
 	{
 		a_out[a_index] = (uint8_t)(a_in >> 56);
@@ -274,6 +280,20 @@ public:
 		a_out[a_index + 7] = (uint8_t)a_in;
 	} // end function ReadUInt64AsBytesBE
 
+	inline static void ReadUInt32AsBytesBE(const uint32_t a_in, uint8_t *a_out, const int32_t a_index)
+	{
+		a_out[a_index] = (uint8_t)(a_in >> 24);
+		a_out[a_index + 1] = (uint8_t)(a_in >> 16);
+		a_out[a_index + 2] = (uint8_t)(a_in >> 8);
+		a_out[a_index + 3] = (uint8_t)a_in;
+	} // end function ReadUInt32AsBytesBE
+
+	inline static void ReadUInt64AsBytesBE(const uint64_t a_in, uint8_t *a_out, const int32_t a_index)
+	{
+		ReadUInt32AsBytesBE(uint32_t(a_in >> 32), a_out, a_index);
+		ReadUInt32AsBytesBE(uint32_t(a_in), a_out, a_index + 4);
+	} // end function ReadUInt64AsBytesBE
+
 	static string ConvertBytesToHexString(const HashLibByteArray &a_in, const bool a_group)
 	{
 		if (a_in.empty()) return string("");
@@ -0,0 +1,523 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library                                 
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald                 
+// *Github Repository <https://github.com/ron4fun>             
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE 
+// *or visit http ://www.opensource.org/licenses/mit-license.php.           
+
+// *Acknowledgements:                                  
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative        
+// *development of this library in Pascal/Delphi                         
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPFILEBATCH_H
+#define HLPFILEBATCH_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include "../Interfaces/HlpIHash.h"
+#include "../Utils/HlpIoUring.h"
+#include "../Utils/HlpMemoryResource.h"
+
+
+/// <summary>
+/// Hashes many files at once. Opens and reads are kept in flight through
+/// io_uring where the kernel offers it, and the completed file contents are
+/// hashed by a pool of worker threads, each owning a "Clone()" of the hash.
+/// Without io_uring every worker opens and reads its own files with pread.
+/// </summary>
+class FileBatch
+{
+public:
+	/// <summary>
+	/// Computes the hash of every file in a_file_names, in order. The entry
+	/// of a file that could not be opened or read is nullptr.
+	/// </summary>
+	/// <param name="a_hash">Hash whose clones do the work, it is not modified itself.</param>
+	/// <param name="a_threads">Number of hashing threads, 0 for one per core.</param>
+	static HashLibHashResultArray ComputeFiles(const IHash &a_hash,
+		const HashLibStringArray &a_file_names, const int32_t a_threads = 0)
+	{
+		HashLibHashResultArray LResults = HashLibHashResultArray(a_file_names.size());
+
+		if (!a_hash)
+			throw ArgumentNilHashLibException(FileBatch::UninitializedInstance);
+
+		if (a_file_names.empty())
+			return LResults;
+
+		FileBatch LBatch(a_file_names, LResults);
+		LBatch.Run(a_hash, a_threads);
+
+		return LResults;
+	} // end function ComputeFiles
+
+private:
+	struct Job
+	{
+		size_t index;
+		bool whole_file; // read and hash the file on the worker itself
+		HashLibResourceByteArray data;
+	}; // end struct Job
+
+	struct Slot
+	{
+		size_t index;
+		int handle;
+		int32_t stage;
+		int64_t length;
+		HashLibResourceByteArray data;
+	}; // end struct Slot
+
+	enum { StageIdle = 0, StageOpen, StageRead, StageClose };
+
+	FileBatch(const HashLibStringArray &a_file_names, HashLibHashResultArray &a_results)
+		: file_names(a_file_names), results(a_results), closed(false), ring_failed(false)
+	{} // end constructor
+
+	void Run(const IHash &a_hash, const int32_t a_threads)
+	{
+		HashLibHashArray LHashers;
+		vector<thread> LWorkers;
+		int32_t LCount;
+		size_t LIdx;
+
+		LCount = a_threads > 0 ? a_threads : int32_t(thread::hardware_concurrency());
+		if (LCount < 1) LCount = 1;
+		if (size_t(LCount) > file_names.size()) LCount = int32_t(file_names.size());
+
+		// cloned up front so an unsupported Clone() throws to the caller
+		for (int32_t i = 0; i < LCount; i++)
+			LHashers.push_back(a_hash->Clone());
+
+		// reserved so push_back cannot throw while holding a running thread
+		LWorkers.reserve(size_t(LCount));
+
+		try
+		{
+			// started inside the try, so a failed start still joins the
+			// workers that are already running
+			for (int32_t i = 0; i < LCount; i++)
+				LWorkers.push_back(thread(&FileBatch::WorkerLoop, this, LHashers[i]));
+
+			if (!ReadWithIoUring())
+			{
+				for (LIdx = 0; LIdx < file_names.size(); LIdx++)
+					PushWholeFile(LIdx);
+			} // end if
+		} // end try
+		catch (...)
+		{
+			Shutdown(LWorkers);
+			throw;
+		} // end catch
+
+		Shutdown(LWorkers);
+	} // end function Run
+
+	void Shutdown(vector<thread> &a_workers)
+	{
+		{
+			lock_guard<mutex> LLock(lock);
+			closed = true;
+		}
+		queue_filled.notify_all();
+
+		for (size_t i = 0; i < a_workers.size(); i++)
+			a_workers[i].join();
+	} // end function Shutdown
+
+	void Push(Job &a_job)
+	{
+		{
+			unique_lock<mutex> LLock(lock);
+			// bound the memory held by buffers waiting to be hashed
+			queue_drained.wait(LLock, [this] { return jobs.size() < MAX_QUEUED_JOBS; });
+			jobs.push_back(Job());
+			jobs.back().index = a_job.index;
+			jobs.back().whole_file = a_job.whole_file;
+			jobs.back().data.swap(a_job.data);
+		}
+		queue_filled.notify_one();
+	} // end function Push
+
+	void PushWholeFile(const size_t a_index)
+	{
+		Job LJob;
+
+		LJob.index = a_index;
+		LJob.whole_file = true;
+		Push(LJob);
+	} // end function PushWholeFile
+
+	void WorkerLoop(IHash a_hash)
+	{
+		HashLibByteArray LBuffer = HashLibByteArray(a_hash->GetBufferSize());
+		Job LJob;
+
+		while (true)
+		{
+			{
+				unique_lock<mutex> LLock(lock);
+				queue_filled.wait(LLock, [this] { return !jobs.empty() || closed; });
+
+				if (jobs.empty()) break;
+
+				LJob.index = jobs.front().index;
+				LJob.whole_file = jobs.front().whole_file;
+				LJob.data.swap(jobs.front().data);
+				jobs.pop_front();
+			}
+			queue_drained.notify_one();
+
+			try
+			{
+				if (LJob.whole_file)
+					results[LJob.index] = ComputeFileByDescriptor(a_hash, file_names[LJob.index], LBuffer);
+				else
+					results[LJob.index] = a_hash->ComputeUntyped(LJob.data.data(), int64_t(LJob.data.size()));
+			} // end try
+			catch (...)
+			{
+				// an unreadable file, or no memory for its result
+				results[LJob.index] = nullptr;
+			} // end catch
+
+			LJob.data.clear();
+		} // end while
+	} // end function WorkerLoop
+
+	static IHashResult ComputeFileByDescriptor(IHash &a_hash, const string &a_file_name,
+		HashLibByteArray &a_buffer)
+	{
+#ifdef HASHLIB_POSIX_IO
+		MappedFile LFile;
+		int64_t LOffset, LReaded;
+
+		if (!LFile.Open(a_file_name))
+			return nullptr;
+
+		a_hash->Initialize();
+		LOffset = 0;
+
+		while (true)
+		{
+			do
+			{
+				LReaded = pread(LFile.GetHandle(), &a_buffer[0], a_buffer.size(), off_t(LOffset));
+			} while (LReaded < 0 && errno == EINTR);
+
+			if (LReaded < 0)
+				return nullptr;
+
+			if (LReaded == 0) break;
+
+			a_hash->TransformBytes(&a_buffer[0], LReaded);
+			LOffset = LOffset + LReaded;
+		} // end while
+
+		return a_hash->TransformFinal();
+#else
+		(void)a_buffer;
+		return a_hash->ComputeFile(a_file_name);
+#endif
+	} // end function ComputeFileByDescriptor
+
+	// Returns false if io_uring is not available, before any file was touched.
+	bool ReadWithIoUring()
+	{
+#ifdef HASHLIB_IO_URING
+		IoUring LRing;
+		IoUring::Completion LCompletion;
+		vector<Slot> LSlots;
+		size_t LNext;
+		uint32_t LActive;
+
+		if (!LRing.Setup(QUEUE_DEPTH))
+			return false;
+
+		LSlots.resize(QUEUE_DEPTH);
+		for (size_t i = 0; i < LSlots.size(); i++)
+		{
+			LSlots[i].handle = -1;
+			LSlots[i].stage = StageIdle;
+		} // end for
+
+		LNext = 0;
+		LActive = 0;
+		ring_failed = false;
+
+		try
+		{
+			for (size_t i = 0; i < LSlots.size() && LNext < file_names.size(); i++)
+			{
+				QueueOpen(LRing, LSlots[i], i, LNext++);
+				LActive++;
+			} // end for
+
+			while (LActive > 0 && !ring_failed)
+			{
+				if (!LRing.Submit(1))
+				{
+					ring_failed = true;
+					break;
+				} // end if
+
+				while (!ring_failed && LRing.GetCompletion(LCompletion))
+				{
+					size_t LSlotIndex = size_t(LCompletion.user_data);
+					Slot &LSlot = LSlots[LSlotIndex];
+
+					if (!Advance(LRing, LSlot, LSlotIndex, LCompletion.res))
+					{
+						if (LNext < file_names.size())
+							QueueOpen(LRing, LSlot, LSlotIndex, LNext++);
+						else
+						{
+							LSlot.stage = StageIdle;
+							LActive--;
+						} // end else
+					} // end if
+				} // end while
+			} // end while
+		} // end try
+		catch (...)
+		{
+			// the kernel may still be writing into the slot buffers
+			Drain(LRing, LSlots);
+			CloseHandles(LSlots);
+			throw;
+		} // end catch
+
+		if (ring_failed)
+		{
+			// the ring itself failed, reap what the kernel already accepted
+			// and finish everything else synchronously
+			Drain(LRing, LSlots);
+
+			for (size_t i = 0; i < LSlots.size(); i++)
+			{
+				if (LSlots[i].stage == StageOpen || LSlots[i].stage == StageRead)
+					PushWholeFile(LSlots[i].index);
+			} // end for
+
+			CloseHandles(LSlots);
+
+			while (LNext < file_names.size())
+				PushWholeFile(LNext++);
+		} // end if
+
+		return true;
+#else
+		return false;
+#endif
+	} // end function ReadWithIoUring
+
+#ifdef HASHLIB_IO_URING
+	// Moves a slot on after one of its operations completed with a_result.
+	// Returns false once the slot is free for the next file.
+	bool Advance(IoUring &a_ring, Slot &a_slot, const size_t a_slot_index, const int32_t a_result)
+	{
+		struct stat LInfo;
+		Job LJob;
+
+		switch (a_slot.stage)
+		{
+		case StageOpen:
+			if (a_result == -EINVAL)
+			{
+				// kernel without IORING_OP_OPENAT
+				PushWholeFile(a_slot.index);
+				return false;
+			} // end if
+
+			if (a_result < 0)
+				return false; // result stays nullptr
+
+			a_slot.handle = a_result;
+			a_slot.length = 0;
+
+			// the size is taken once and the reads stop there. Files that
+			// report no size, like those of procfs, and files too large to
+			// hold in memory are streamed by a worker instead
+			if (fstat(a_slot.handle, &LInfo) != 0 || !S_ISREG(LInfo.st_mode) || LInfo.st_size <= 0
+				|| uint64_t(LInfo.st_size) > MAX_BUFFERED_FILE_SIZE)
+			{
+				PushWholeFile(a_slot.index);
+				QueueClose(a_ring, a_slot, a_slot_index);
+				return true;
+			} // end if
+
+			// every byte is overwritten by the reads, so none is zeroed first
+			a_slot.data.resize(size_t(LInfo.st_size));
+			QueueRead(a_ring, a_slot, a_slot_index);
+			return true;
+
+		case StageRead:
+			if (a_result < 0)
+			{
+				if (a_result == -EINVAL) PushWholeFile(a_slot.index);
+				QueueClose(a_ring, a_slot, a_slot_index);
+				return true;
+			} // end if
+
+			a_slot.length = a_slot.length + a_result;
+
+			// short reads can happen anywhere, a read of nothing means the
+			// file shrank after fstat
+			if (a_result > 0 && a_slot.length < int64_t(a_slot.data.size()))
+			{
+				QueueRead(a_ring, a_slot, a_slot_index);
+				return true;
+			} // end if
+
+			a_slot.data.resize(size_t(a_slot.length));
+			LJob.index = a_slot.index;
+			LJob.whole_file = false;
+			LJob.data.swap(a_slot.data);
+			Push(LJob);
+
+			QueueClose(a_ring, a_slot, a_slot_index);
+			return true;
+
+		default:
+			if (a_result == -EINVAL)
+				close(a_slot.handle); // kernel without IORING_OP_CLOSE
+
+			a_slot.handle = -1;
+			return false;
+		} // end switch
+	} // end function Advance
+
+	// Reaps every operation the kernel still holds, so no slot buffer or
+	// file name is released while it may be written to or read from.
+	static void Drain(IoUring &a_ring, vector<Slot> &a_slots)
+	{
+		IoUring::Completion LCompletion;
+
+		while (a_ring.GetInFlight() > 0)
+		{
+			if (!a_ring.GetCompletion(LCompletion))
+			{
+				a_ring.WaitForCompletion();
+				continue;
+			} // end if
+
+			Slot &LSlot = a_slots[size_t(LCompletion.user_data)];
+
+			if (LSlot.stage == StageOpen && LCompletion.res >= 0)
+				LSlot.handle = LCompletion.res;
+			else if (LSlot.stage == StageClose && LCompletion.res != -EINVAL)
+				LSlot.handle = -1;
+		} // end while
+	} // end function Drain
+
+	static void CloseHandles(vector<Slot> &a_slots)
+	{
+		for (size_t i = 0; i < a_slots.size(); i++)
+		{
+			if (a_slots[i].handle != -1)
+				close(a_slots[i].handle);
+
+			a_slots[i].handle = -1;
+			a_slots[i].stage = StageIdle;
+		} // end for
+	} // end function CloseHandles
+
+	// There is one ring entry per slot, so the queue is only full while the
+	// kernel has not taken the earlier entries yet. Returns nullptr and marks
+	// the ring failed if pushing those out does not free one.
+	IoUring::Submission * GetSubmission(IoUring &a_ring)
+	{
+		IoUring::Submission *LEntry = a_ring.GetSubmission();
+
+		if (!LEntry && a_ring.Submit(0))
+			LEntry = a_ring.GetSubmission();
+
+		if (!LEntry)
+			ring_failed = true;
+
+		return LEntry;
+	} // end function GetSubmission
+
+	void QueueOpen(IoUring &a_ring, Slot &a_slot, const size_t a_slot_index, const size_t a_index)
+	{
+		IoUring::Submission *LEntry;
+
+		a_slot.index = a_index;
+		a_slot.handle = -1;
+		a_slot.stage = StageOpen;
+
+		LEntry = GetSubmission(a_ring);
+		if (!LEntry) return;
+
+		LEntry->opcode = IORING_OP_OPENAT;
+		LEntry->fd = AT_FDCWD;
+		LEntry->addr = uint64_t(uintptr_t(file_names[a_index].c_str()));
+		LEntry->open_flags = O_RDONLY | O_CLOEXEC;
+		LEntry->user_data = a_slot_index;
+	} // end function QueueOpen
+
+	void QueueRead(IoUring &a_ring, Slot &a_slot, const size_t a_slot_index)
+	{
+		IoUring::Submission *LEntry;
+
+		a_slot.stage = StageRead;
+
+		LEntry = GetSubmission(a_ring);
+		if (!LEntry) return;
+
+		LEntry->opcode = IORING_OP_READ;
+		LEntry->fd = a_slot.handle;
+		LEntry->addr = uint64_t(uintptr_t(&a_slot.data[size_t(a_slot.length)]));
+		LEntry->len = uint32_t(a_slot.data.size() - size_t(a_slot.length));
+		LEntry->off = uint64_t(a_slot.length);
+		LEntry->user_data = a_slot_index;
+	} // end function QueueRead
+
+	void QueueClose(IoUring &a_ring, Slot &a_slot, const size_t a_slot_index)
+	{
+		IoUring::Submission *LEntry;
+
+		a_slot.stage = StageClose;
+
+		LEntry = GetSubmission(a_ring);
+		if (!LEntry) return;
+
+		LEntry->opcode = IORING_OP_CLOSE;
+		LEntry->fd = a_slot.handle;
+		LEntry->user_data = a_slot_index;
+	} // end function QueueClose
+#endif
+
+public:
+	static const char *UninitializedInstance;
+
+private:
+	// one operation per slot is in flight, so this is also the ring size
+	static const uint32_t QUEUE_DEPTH = 256;
+	static const size_t MAX_QUEUED_JOBS = 1024;
+	static const size_t MAX_BUFFERED_FILE_SIZE = 4 * 1024 * 1024; // 4Mb
+
+	const HashLibStringArray &file_names;
+	HashLibHashResultArray &results;
+
+	deque<Job> jobs;
+	bool closed;
+	// set once a ring operation could not be queued or submitted, the rest
+	// of the batch is then read synchronously
+	bool ring_failed;
+	mutex lock;
+	condition_variable queue_filled, queue_drained;
+
+}; // end class FileBatch
+
+const char *FileBatch::UninitializedInstance = "Uninitialized Hash Instance";
+
+
+#endif // !HLPFILEBATCH_H
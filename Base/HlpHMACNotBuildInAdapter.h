@@ -42,20 +42,28 @@ public:
 
 	virtual IHash Clone() const
 	{
-		return hash;
+		IHash hmac = make_shared<HMACNotBuildInAdapter>(Copy());
+		hmac->SetBufferSize(GetBufferSize());
+
+		return hmac;
 	}
 
 	virtual IHMAC CloneHMAC() const
 	{
-		HMACNotBuildInAdapter hmac = HMACNotBuildInAdapter(hash->Clone());
-		hmac.blocksize = blocksize;
-		hmac.opad = opad;
-		hmac.ipad = ipad;
-		hmac.key = key;
-
-		return make_shared<HMACNotBuildInAdapter>(hmac);
+		return make_shared<HMACNotBuildInAdapter>(Copy());
 	}
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const HMACNotBuildInAdapter &LSource = GetStateSource<HMACNotBuildInAdapter>(a_source);
+
+		hash->CopyStateFrom(*LSource.hash);
+		opad = LSource.opad;
+		ipad = LSource.ipad;
+		key = LSource.key;
+		blocksize = LSource.blocksize;
+	} // end function CopyStateFrom
+
 	virtual void Initialize()
 	{
 		hash->Initialize();
@@ -74,9 +82,9 @@ public:
 		return result;
 	} // end function TransformFinal
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
-		hash->TransformBytes(a_data, a_index, a_length);
+		hash->TransformBytes(a_data, a_length);
 	} // end function TransformBytes
 
 protected:
@@ -88,6 +96,11 @@ protected:
 		return ss.str();
 	} // end function GetName
 
+	virtual string GetKernelName() const
+	{
+		return hash->GetKernelName();
+	} // end function GetKernelName
+
 	virtual HashLibByteArray GetKey() const
 	{
 		return key;
@@ -133,6 +146,17 @@ protected:
 		} // end while
 	} // end function UpdatePads
 
+	HMACNotBuildInAdapter Copy() const
+	{
+		HMACNotBuildInAdapter hmac = HMACNotBuildInAdapter(hash->Clone());
+		hmac.blocksize = blocksize;
+		hmac.opad = opad;
+		hmac.ipad = ipad;
+		hmac.key = key;
+
+		return hmac;
+	} // end function Copy
+
 private:
 	IHash hash;
 	HashLibByteArray opad, ipad, key;
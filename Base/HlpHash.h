@@ -18,8 +18,15 @@
 
 #include <typeinfo>
 #include "HlpHashResult.h"
+#include "HlpHashState.h"
 #include "../Interfaces/HlpIHash.h"
 #include "../Utils/HlpUtils.h"
+#include "../Utils/HlpMappedFile.h"
+#include "../Utils/HlpReadAheadRing.h"
+
+#ifdef HASHLIB_POSIX_IO
+	#include <sys/uio.h>
+#endif
 
 class Hash : public virtual IIHash
 {
@@ -32,6 +39,15 @@ private:
 	static const char *UnAssignedStream;
 	static const char *FileNotExist;
 	static const char *CloneNotYetImplemented;
+	static const char *StateCopyNotYetImplemented;
+	static const char *IncompatibleState;
+	static const char *StateSerializationNotYetImplemented;
+	static const char *FileReadError;
+	static const char *InvalidReadAheadDepth;
+	static const char *DescriptorNotSupported;
+	static const char *IovNotSupported;
+	static const char *OutputBufferTooShort;
+	static const char *DigestSizeMismatch;
 
 protected:
 	virtual inline int32_t GetBufferSize() const
@@ -51,6 +67,33 @@ protected:
 		} // end else
 	} // end function SetBufferSize
 
+	virtual inline int32_t GetReadAheadDepth() const
+	{
+		return read_ahead_depth;
+	} // end function GetReadAheadDepth
+
+	virtual inline void SetReadAheadDepth(const int32_t value)
+	{
+		if (value >= 0)
+		{
+			read_ahead_depth = value;
+		} // end if
+		else
+		{
+			throw ArgumentHashLibException(Hash::InvalidReadAheadDepth);
+		} // end else
+	} // end function SetReadAheadDepth
+
+	virtual inline FileReadMode GetFileReadMode() const
+	{
+		return file_read_mode;
+	} // end function GetFileReadMode
+
+	virtual inline void SetFileReadMode(const FileReadMode value)
+	{
+		file_read_mode = value;
+	} // end function SetFileReadMode
+
 	virtual int32_t GetBlockSize() const
 	{
 		return block_size;
@@ -63,7 +106,8 @@ protected:
 
 public:
 	Hash(const int32_t a_hash_size, const int32_t a_block_size)
-		: block_size(a_block_size), hash_size(a_hash_size), buffer_size(BUFFER_SIZE)
+		: block_size(a_block_size), hash_size(a_hash_size), buffer_size(BUFFER_SIZE),
+		read_ahead_depth(0), file_read_mode(FileReadStream)
 	{} // end constructor
 	
 	virtual string GetName() const
@@ -71,14 +115,58 @@ public:
 		return name;
 	} // end function GetName
 
+	// Name of the block function implementation in use, "Portable" unless
+	// the algorithm selected an accelerated kernel for this CPU.
+	virtual string GetKernelName() const
+	{
+		return "Portable";
+	} // end function GetKernelName
+
 	virtual IHash Clone() const
 	{
 		throw NotImplementedHashLibException(Utils::string_format(Hash::CloneNotYetImplemented, GetName()));
 	}
 
+	// Overwrites this instance with the running state of "a_source", which
+	// must be of the same concrete type. Unlike Clone() no new instance is
+	// allocated, so a precomputed midstate can be restored cheaply per message.
+	virtual void CopyStateFrom(const IIHash &)
+	{
+		throw NotImplementedHashLibException(Utils::string_format(Hash::StateCopyNotYetImplemented, GetName()));
+	} // end function CopyStateFrom
+
+	// Exports the running state as a versioned blob that RestoreState() on
+	// an instance of the same algorithm, possibly in another process, accepts.
+	virtual HashLibByteArray SaveState() const
+	{
+		HashStateWriter LWriter = HashStateWriter(GetName(), GetHashSize());
+		WriteState(LWriter);
+
+		return LWriter.GetBytes();
+	} // end function SaveState
+
+	virtual void RestoreState(const HashLibByteArray &a_state)
+	{
+		HashStateReader LReader = HashStateReader(a_state, GetName(), GetHashSize());
+
+		try
+		{
+			// a fresh instance may not have built its tables yet
+			Initialize();
+			ReadState(LReader);
+			LReader.Finish();
+		} // end try
+		catch (...)
+		{
+			// never leave a half restored state behind
+			Initialize();
+			throw;
+		} // end catch
+	} // end function RestoreState
+
 	virtual IHashResult ComputeString(const string &a_data)
 	{
-		return ComputeBytes(Converters::ConvertStringToBytes(a_data));
+		return ComputeUntyped(a_data.data(), (int64_t)a_data.size());
 	} // end function ComputeString
 
 	virtual IHashResult ComputeUntyped(const void *a_data, const int64_t a_length)
@@ -88,45 +176,83 @@ public:
 		return TransformFinal();
 	} // end function ComputeUntyped
 
-	virtual void TransformUntyped(const void *a_data, const int64_t a_length)
+	virtual void ComputeInto(const void *a_data, const int64_t a_length,
+		uint8_t *a_output, const size_t a_output_length)
 	{
-		uint8_t *PtrBuffer, *PtrEnd;
-		HashLibByteArray ArrBuffer;
-		int32_t LBufferSize;
+		ValidateOutputLength(a_output_length);
 
-		PtrBuffer = (uint8_t *)a_data;
+		Initialize();
+		TransformUntyped(a_data, a_length);
+		TransformFinalInto(a_output, a_output_length);
+	} // end function ComputeInto
 
-		if (buffer_size > a_length) // Sanity Check
-			LBufferSize = BUFFER_SIZE;
-		else
-			LBufferSize = buffer_size;
+	virtual HashValue ComputeValue(const void *a_data, const int64_t a_length)
+	{
+		Initialize();
+		TransformUntyped(a_data, a_length);
+		return TransformFinalValue();
+	} // end function ComputeValue
 
-		if (PtrBuffer)
-		{
-			ArrBuffer.resize(LBufferSize);
-			PtrEnd = (PtrBuffer) + a_length;
+	virtual IHashResult ComputeUntypedIn(const void *a_data, const int64_t a_length,
+		MemoryResource &a_resource)
+	{
+		Initialize();
+		TransformUntyped(a_data, a_length);
+		return TransformFinalIn(a_resource);
+	} // end function ComputeUntypedIn
 
-			while (PtrBuffer < PtrEnd)
-			{
-				if ((PtrEnd - PtrBuffer) >= LBufferSize)
-				{
-					memmove(&ArrBuffer[0], PtrBuffer, LBufferSize);
-					TransformBytes(ArrBuffer);
-					PtrBuffer += LBufferSize;
-				} // end if
-				else
-				{
-					ArrBuffer.resize(PtrEnd - PtrBuffer);
-					memmove(&ArrBuffer[0], PtrBuffer, ArrBuffer.size());
-					TransformBytes(ArrBuffer);
-					break;
-				} // end else
-			} // end while
+	virtual void TransformUntyped(const void *a_data, const int64_t a_length)
+	{
+		const uint8_t *PtrBuffer;
 
-		} // end if
+		PtrBuffer = (const uint8_t *)a_data;
+
+		// the caller's memory is handed to the algorithm in place
+		if (PtrBuffer && a_length > 0)
+			TransformBytes(PtrBuffer, a_length);
 
 	} // end function TransformUntyped
 
+	// Hashes the fragments as one message. Each fragment goes straight to
+	// TransformBytes, so a block split across fragments is completed in the
+	// algorithm's own buffer and nothing is concatenated up front.
+	virtual void TransformSpans(const HashLibSpan *a_spans, const size_t a_count)
+	{
+		for (size_t i = 0; i < a_count; i++)
+		{
+			if (a_spans[i].data && a_spans[i].length > 0)
+				TransformBytes(a_spans[i].data, a_spans[i].length);
+		} // end for
+	} // end function TransformSpans
+
+	virtual void TransformSpans(const HashLibSpanArray &a_spans)
+	{
+		if (!a_spans.empty())
+			TransformSpans(&a_spans[0], a_spans.size());
+	} // end function TransformSpans
+
+	virtual void TransformIov(const struct iovec *a_iov, const size_t a_count)
+	{
+#ifdef HASHLIB_POSIX_IO
+		for (size_t i = 0; i < a_count; i++)
+		{
+			if (a_iov[i].iov_base && a_iov[i].iov_len > 0)
+				TransformBytes((const uint8_t *)a_iov[i].iov_base, int64_t(a_iov[i].iov_len));
+		} // end for
+#else
+		(void)a_iov;
+		(void)a_count;
+		throw NotImplementedHashLibException(Hash::IovNotSupported);
+#endif
+	} // end function TransformIov
+
+	virtual IHashResult ComputeSpans(const HashLibSpanArray &a_spans)
+	{
+		Initialize();
+		TransformSpans(a_spans);
+		return TransformFinal();
+	} // end function ComputeSpans
+
 	virtual IHashResult ComputeStream(ifstream &a_stream, const int64_t a_length = -1)
 	{
 		Initialize();
@@ -134,6 +260,27 @@ public:
 		return TransformFinal();
 	} // end function ComputeStream
 
+	virtual IHashResult ComputeStream(istream &a_stream, const int64_t a_length = -1)
+	{
+		Initialize();
+		TransformStream(a_stream, a_length);
+		return TransformFinal();
+	} // end function ComputeStream
+
+	virtual IHashResult ComputeStream(streambuf &a_stream, const int64_t a_length = -1)
+	{
+		Initialize();
+		TransformStream(a_stream, a_length);
+		return TransformFinal();
+	} // end function ComputeStream
+
+	virtual IHashResult ComputeDescriptor(const int a_handle, const int64_t a_length = -1)
+	{
+		Initialize();
+		TransformDescriptor(a_handle, a_length);
+		return TransformFinal();
+	} // end function ComputeDescriptor
+
 	virtual IHashResult ComputeFile(const string &a_file_name,
 		const int64_t a_from = 0, const int64_t a_length = -1)
 	{
@@ -151,29 +298,77 @@ public:
 
 	virtual void TransformString(const string &a_data)
 	{
-		TransformBytes(Converters::ConvertStringToBytes(a_data));
+		TransformUntyped(a_data.data(), (int64_t)a_data.size());
 	} // end function TransformString
 
 	virtual void TransformBytes(const HashLibByteArray &a_data)
 	{
-		TransformBytes(a_data, 0, (int32_t)a_data.size());
+		TransformBytes(a_data.data(), (int64_t)a_data.size());
 	} // end function TransformBytes
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, const int32_t a_index)
+	virtual void TransformBytes(const HashLibByteArray &a_data, const int64_t a_index)
 	{
-		int32_t Length = (int32_t)a_data.size() - a_index;
+		int64_t Length = (int64_t)a_data.size() - a_index;
 		TransformBytes(a_data, a_index, Length);
 	} // end function TransformBytes
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length) = 0;
+	virtual void TransformBytes(const HashLibByteArray &a_data, int64_t a_index, int64_t a_length)
+	{
+		TransformBytes(a_data.data() + a_index, a_length);
+	} // end function TransformBytes
+
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length) = 0;
+
+	// Writes the digest to a_output, which must hold at least GetHashSize()
+	// bytes. This generic version goes through TransformFinal; algorithms
+	// that can write their state out directly override it to skip the
+	// intermediate result objects. A digest of any other size than
+	// GetHashSize() is refused rather than left partly written.
+	virtual void TransformFinalInto(uint8_t *a_output, const size_t a_output_length)
+	{
+		ValidateOutputLength(a_output_length);
+
+		HashLibByteArray tempresult = TransformFinal()->GetBytes();
+
+		if (tempresult.size() != size_t(GetHashSize()))
+			throw InvalidOperationHashLibException(Hash::DigestSizeMismatch);
+
+		if (!tempresult.empty())
+			memmove(a_output, &tempresult[0], tempresult.size() * sizeof(uint8_t));
+	} // end function TransformFinalInto
+
+	virtual HashValue TransformFinalValue()
+	{
+		HashValue result;
+
+		result.SetLength(size_t(GetHashSize()));
+		TransformFinalInto(result.GetData(), result.GetLength());
+
+		return result;
+	} // end function TransformFinalValue
+
+	// Like TransformFinal, but the result object and its bytes live in
+	// a_resource, so with an arena no heap allocation is left per digest.
+	virtual IHashResult TransformFinalIn(MemoryResource &a_resource)
+	{
+		if (size_t(GetHashSize()) > HashValue::MAX_LENGTH)
+		{
+			HashLibByteArray LBytes = TransformFinal()->GetBytes();
+
+			return HashResult::Create(LBytes.empty() ? nullptr : &LBytes[0], LBytes.size(), a_resource);
+		} // end if
+
+		HashValue LValue = TransformFinalValue();
+
+		return HashResult::Create(LValue.GetData(), LValue.GetLength(), a_resource);
+	} // end function TransformFinalIn
 
 	virtual void TransformStream(ifstream &a_stream, const int64_t a_length = -1)
 	{
-		int32_t readed = 0, LBufferSize;
-		uint64_t size, new_size;
-		int64_t total;
+		uint64_t size;
+		int64_t LRemaining;
+		int32_t LBufferSize;
 
-		total = 0;
 		size = GetStreamSize(a_stream);
 
 		if (a_stream)
@@ -190,68 +385,141 @@ public:
 		else
 			throw ArgumentNilHashLibException(Hash::UnAssignedStream);
 
+		LRemaining = a_length > -1 ? a_length : int64_t(size - uint64_t(a_stream.tellg()));
+		if (LRemaining <= 0)
+			return;
 
-		if (size > BUFFER_SIZE)
+		LBufferSize = LRemaining < buffer_size ? int32_t(LRemaining) : buffer_size;
+
+		auto LReader = [&a_stream, &LRemaining](uint8_t *a_buffer, const int64_t a_capacity) -> int64_t
 		{
-			if (a_length == -1) LBufferSize = BUFFER_SIZE;
-			else
-			{
-				LBufferSize = a_length > BUFFER_SIZE ? BUFFER_SIZE : a_length;
-			}
-		}
-		else
+			int64_t LCount;
+
+			if (LRemaining <= 0)
+				return 0;
+
+			a_stream.read((char *)a_buffer, LRemaining < a_capacity ? LRemaining : a_capacity);
+			LCount = a_stream.gcount();
+			LRemaining = LRemaining - LCount;
+
+			return LCount;
+		};
+
+		TransformReader(LReader, LBufferSize);
+	} // end function TransformStream
+
+	virtual void TransformStream(istream &a_stream, const int64_t a_length = -1)
+	{
+		int64_t LRemaining = a_length;
+
+		if (!a_stream)
+			throw ArgumentNilHashLibException(Hash::UnAssignedStream);
+
+		if (a_length == 0)
+			return;
+
+		// never seeks, so pipes, sockets and std::cin work as well as files
+		TransformReader([&a_stream, &LRemaining](uint8_t *a_buffer, const int64_t a_capacity) -> int64_t
 		{
-			LBufferSize = a_length == -1 ? size : a_length;
-		}	
+			int64_t LCount;
+
+			if (LRemaining == 0)
+				return 0;
+
+			a_stream.read((char *)a_buffer, LRemaining > -1 && LRemaining < a_capacity ? LRemaining : a_capacity);
+			LCount = a_stream.gcount();
 
-		HashLibByteArray data = HashLibByteArray(LBufferSize);
+			if (LRemaining > 0)
+				LRemaining = LRemaining - LCount;
 
-		if (LBufferSize == BUFFER_SIZE)
+			return LCount;
+		}, GetReadBufferSize(a_length));
+	} // end function TransformStream
+
+	virtual void TransformStream(streambuf &a_stream, const int64_t a_length = -1)
+	{
+		int64_t LRemaining = a_length;
+
+		if (a_length == 0)
+			return;
+
+		TransformReader([&a_stream, &LRemaining](uint8_t *a_buffer, const int64_t a_capacity) -> int64_t
 		{
-			while (true)
-			{
-				a_stream.read((char*)&data[0], LBufferSize);
+			int64_t LCount;
 
-				readed = a_stream.gcount();
-				if (readed != BUFFER_SIZE)
-				{
-					data.resize(readed);
+			if (LRemaining == 0)
+				return 0;
 
-					TransformBytes(data, 0, readed);
+			LCount = int64_t(a_stream.sgetn((char *)a_buffer,
+				streamsize(LRemaining > -1 && LRemaining < a_capacity ? LRemaining : a_capacity)));
+
+			if (LRemaining > 0)
+				LRemaining = LRemaining - LCount;
+
+			return LCount;
+		}, GetReadBufferSize(a_length));
+	} // end function TransformStream
+
+	virtual void TransformDescriptor(const int a_handle, const int64_t a_length = -1)
+	{
+#ifdef HASHLIB_POSIX_IO
+		int64_t LRemaining = a_length;
+
+		if (a_handle < 0)
+			throw ArgumentNilHashLibException(Hash::UnAssignedStream);
 
-					break;
-				}
-					
-				if (readed == 0) break;
+		if (a_length == 0)
+			return;
 
-				total = total + readed;
+		TransformReader([a_handle, &LRemaining](uint8_t *a_buffer, const int64_t a_capacity) -> int64_t
+		{
+			int64_t LWanted, LCount;
+			ssize_t LReaded;
 
-				TransformBytes(data, 0, readed);
+			LWanted = LRemaining > -1 && LRemaining < a_capacity ? LRemaining : a_capacity;
+			LCount = 0;
 
-				if (a_length != -1 && a_length - total <= BUFFER_SIZE)
+			// pipes hand out a few Kb per read, gather a whole buffer first
+			while (LCount < LWanted)
+			{
+				LReaded = read(a_handle, a_buffer + LCount, size_t(LWanted - LCount));
+				if (LReaded < 0)
 				{
-					new_size = a_length - total;
-					data.resize(new_size);
+					if (errno == EINTR) continue;
+					throw InvalidOperationHashLibException(Hash::FileReadError);
+				} // end if
 
-					a_stream.read((char*)&data[0], new_size);
+				if (LReaded == 0) break;
 
-					TransformBytes(data, 0, new_size);
-					break;
-				}
-			
+				LCount = LCount + LReaded;
 			} // end while
-		}
-		else
-		{
-			a_stream.read((char*)&data[0], LBufferSize);
 
-			TransformBytes(data, 0, LBufferSize);
-		}		
-	} // end function TransformStream
+			if (LRemaining > 0)
+				LRemaining = LRemaining - LCount;
+
+			return LCount;
+		}, GetReadBufferSize(a_length));
+#else
+		(void)a_handle;
+		(void)a_length;
+		throw NotImplementedHashLibException(Hash::DescriptorNotSupported);
+#endif
+	} // end function TransformDescriptor
 
 	virtual void TransformFile(const string &a_file_name,
 		const int64_t a_from = 0, const int64_t a_length = -1)
 	{
+		if (file_read_mode == FileReadMapped)
+		{
+			if (TransformMappedFile(a_file_name, a_from, a_length))
+				return;
+		} // end if
+		else if (file_read_mode == FileReadDirect)
+		{
+			if (TransformDirectFile(a_file_name, a_from, a_length))
+				return;
+		} // end else if
+
 		ifstream ReadFile;
 		ReadFile.open(a_file_name.c_str(), ios::in | ios::binary);
 
@@ -267,6 +535,222 @@ public:
 
 
 private:
+	// Returns false when the file can not be opened this way, so the caller
+	// can fall back to the stream path.
+	bool TransformMappedFile(const string &a_file_name, const int64_t a_from, const int64_t a_length)
+	{
+#ifdef HASHLIB_POSIX_IO
+		MappedFile LFile;
+		const uint8_t *PtrView;
+		int64_t LPosition, LEnd, LWindow;
+
+		if (!LFile.Open(a_file_name))
+			return false;
+
+		if (!LFile.GetIsRegular())
+		{
+			// pipes, sockets and devices can neither be mapped nor sized
+			TransformDescriptorRange(LFile.GetHandle(), a_from, a_length);
+			return true;
+		} // end if
+
+		if (a_length > -1)
+		{
+			if (a_from + a_length > LFile.GetSize())
+				throw IndexOutOfRangeHashLibException(Hash::IndexOutOfRange);
+		} // end if
+
+		LPosition = a_from;
+		LEnd = a_length > -1 ? a_from + a_length : LFile.GetSize();
+
+		while (LPosition < LEnd)
+		{
+			LWindow = LEnd - LPosition;
+			if (LWindow > MappedFile::WINDOW_SIZE)
+				LWindow = MappedFile::WINDOW_SIZE;
+
+			PtrView = LFile.Map(LPosition, LWindow);
+			if (!PtrView)
+			{
+				// mmap refused the range, read what is left instead
+				TransformDescriptorRange(LFile.GetHandle(), LPosition, LEnd - LPosition);
+				break;
+			} // end if
+
+			TransformUntyped(PtrView, LWindow);
+			LPosition = LPosition + LWindow;
+		} // end while
+
+		return true;
+#else
+		return false;
+#endif
+	} // end function TransformMappedFile
+
+	// Returns false when the file can not be opened for unbuffered reads, so
+	// the caller can fall back to the stream path. Chunks are read by several
+	// threads at once (the read ahead depth, at least DIRECT_READ_DEPTH) so the
+	// device sees that many requests queued while the caller hashes in order.
+	bool TransformDirectFile(const string &a_file_name, const int64_t a_from, const int64_t a_length)
+	{
+#ifdef HASHLIB_POSIX_IO
+		MappedFile LFile;
+		int64_t LPosition, LEnd, LAlignment, LStart;
+		int32_t LBufferSize, LReaders;
+
+		if (!LFile.Open(a_file_name, true))
+			return false;
+
+		if (!LFile.GetIsRegular())
+		{
+			TransformDescriptorRange(LFile.GetHandle(), a_from, a_length);
+			return true;
+		} // end if
+
+		if (a_length > -1)
+		{
+			if (a_from + a_length > LFile.GetSize())
+				throw IndexOutOfRangeHashLibException(Hash::IndexOutOfRange);
+		} // end if
+
+		LPosition = a_from;
+		LEnd = a_length > -1 ? a_from + a_length : LFile.GetSize();
+
+		if (LPosition >= LEnd)
+			return true;
+
+		// unbuffered reads must start and stop on page boundaries
+		LAlignment = MappedFile::GetPageSize();
+		LBufferSize = buffer_size;
+		if (LBufferSize < DIRECT_BUFFER_SIZE)
+			LBufferSize = DIRECT_BUFFER_SIZE;
+		LBufferSize = int32_t((LBufferSize + LAlignment - 1) & ~(LAlignment - 1));
+
+		// chunk i covers [LStart + i * LBufferSize, LStart + (i + 1) * LBufferSize)
+		LStart = LPosition & ~(LAlignment - 1);
+
+		auto LReader = [&LFile, LPosition, LStart, LEnd](uint8_t *a_buffer, const int64_t a_capacity,
+			const uint64_t a_index) -> int64_t
+		{
+			int64_t LOffset, LHead, LCount, LReaded;
+
+			LOffset = LStart + int64_t(a_index) * a_capacity;
+			if (LOffset >= LEnd)
+				return 0;
+
+			// only the first chunk starts before the requested range
+			LHead = a_index == 0 ? LPosition - LStart : 0;
+			LCount = 0;
+
+			while (LCount < a_capacity && LOffset + LCount < LEnd)
+			{
+				do
+				{
+					LReaded = pread(LFile.GetHandle(), a_buffer + LCount, size_t(a_capacity - LCount),
+						off_t(LOffset + LCount));
+				} while (LReaded < 0 && errno == EINTR);
+
+				if (LReaded < 0)
+					throw InvalidOperationHashLibException(Hash::FileReadError);
+
+				if (LReaded == 0) break; // file shrank underneath us
+
+				LCount = LCount + LReaded;
+			} // end while
+
+			// the tail block is read whole, only the bytes in range are kept
+			if (LOffset + LCount > LEnd)
+				LCount = LEnd - LOffset;
+
+			if (LCount <= LHead)
+				return 0;
+
+			if (LHead > 0)
+				memmove(a_buffer, a_buffer + LHead, size_t(LCount - LHead));
+
+			return LCount - LHead;
+		};
+
+		// one slot more than readers, so every reader has a request queued
+		// while the oldest chunk hashes
+		LReaders = read_ahead_depth;
+		if (LReaders < DIRECT_READ_DEPTH)
+			LReaders = DIRECT_READ_DEPTH;
+		ReadAheadRing LRing(LReaders + 1, LBufferSize, int32_t(LAlignment));
+
+		LRing.Run(LReader, [this](const uint8_t *a_buffer, const int64_t a_length)
+		{
+			TransformBytes(a_buffer, a_length);
+		}, LReaders);
+
+		return true;
+#else
+		return false;
+#endif
+	} // end function TransformDirectFile
+
+#ifdef HASHLIB_POSIX_IO
+	void TransformDescriptorRange(const int a_handle, const int64_t a_from, const int64_t a_length)
+	{
+		HashLibResourceByteArray LBuffer;
+		int64_t LSkip;
+		ssize_t LReaded;
+
+		if (a_from > 0 && lseek(a_handle, off_t(a_from), SEEK_SET) == off_t(-1))
+		{
+			// not seekable, consume the leading bytes instead
+			LBuffer.resize(buffer_size);
+			LSkip = a_from;
+
+			while (LSkip > 0)
+			{
+				LReaded = read(a_handle, &LBuffer[0], size_t(LSkip < buffer_size ? LSkip : buffer_size));
+				if (LReaded < 0)
+				{
+					if (errno == EINTR) continue;
+					throw InvalidOperationHashLibException(Hash::FileReadError);
+				} // end if
+
+				if (LReaded == 0) return;
+
+				LSkip = LSkip - LReaded;
+			} // end while
+		} // end if
+
+		TransformDescriptor(a_handle, a_length);
+	} // end function TransformDescriptorRange
+#endif
+
+	// Hashes everything a_reader produces, reading ahead on a separate thread
+	// when a read ahead depth is set.
+	void TransformReader(const ReadAheadRing::Reader &a_reader, const int32_t a_buffer_size)
+	{
+		int64_t LReaded;
+
+		if (read_ahead_depth > 1)
+		{
+			ReadAheadRing LRing(read_ahead_depth, a_buffer_size);
+
+			LRing.Run(a_reader, [this](const uint8_t *a_buffer, const int64_t a_length)
+			{
+				TransformBytes(a_buffer, a_length);
+			});
+		} // end if
+		else
+		{
+			HashLibByteArray data = HashLibByteArray(a_buffer_size);
+
+			while ((LReaded = a_reader(&data[0], a_buffer_size)) > 0)
+				TransformBytes(&data[0], LReaded);
+		} // end else
+	} // end function TransformReader
+
+	inline int32_t GetReadBufferSize(const int64_t a_length) const
+	{
+		return a_length > -1 && a_length < buffer_size ? int32_t(a_length) : buffer_size;
+	} // end function GetReadBufferSize
+
+
 	static streampos GetStreamSize(ifstream &a_stream)
 	{
 		streampos pos = a_stream.tellg();
@@ -282,11 +766,40 @@ private:
 	
 
 protected:
+	virtual void WriteState(HashStateWriter &) const
+	{
+		throw NotImplementedHashLibException(Utils::string_format(Hash::StateSerializationNotYetImplemented, GetName()));
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &)
+	{
+		throw NotImplementedHashLibException(Utils::string_format(Hash::StateSerializationNotYetImplemented, GetName()));
+	} // end function ReadState
+
+	template <typename T>
+	inline const T & GetStateSource(const IIHash &a_source) const
+	{
+		if (typeid(a_source) != typeid(*this))
+			throw ArgumentHashLibException(Hash::IncompatibleState);
+
+		return dynamic_cast<const T &>(a_source);
+	} // end function GetStateSource
+
+	inline void ValidateOutputLength(const size_t a_output_length) const
+	{
+		if (a_output_length < size_t(GetHashSize()))
+			throw ArgumentOutOfRangeHashLibException(Hash::OutputBufferTooShort);
+	} // end function ValidateOutputLength
+
 	int32_t buffer_size;
 	int32_t block_size;
 	int32_t hash_size;
+	int32_t read_ahead_depth;
+	FileReadMode file_read_mode;
 
 	static const int32_t BUFFER_SIZE = int32_t(64 * 1024); // 64Kb
+	static const int32_t DIRECT_BUFFER_SIZE = int32_t(4 * 1024 * 1024); // 4Mb
+	static const int32_t DIRECT_READ_DEPTH = 4;
 
 
 }; // end class Hash
@@ -296,5 +809,14 @@ const char *Hash::InvalidBufferSize = "\"BufferSize\" Must Be Greater Than Zero"
 const char *Hash::UnAssignedStream = "Input Stream Is Unassigned";
 const char *Hash::FileNotExist = "Specified File Not Found";
 const char *Hash::CloneNotYetImplemented = "Clone Not Yet Implemented For \"%s\"";
+const char *Hash::StateCopyNotYetImplemented = "State Copy Not Yet Implemented For \"%s\"";
+const char *Hash::IncompatibleState = "Source Hash Instance Is Not Of The Same Type";
+const char *Hash::StateSerializationNotYetImplemented = "State Serialization Not Yet Implemented For \"%s\"";
+const char *Hash::FileReadError = "Error Reading From File";
+const char *Hash::InvalidReadAheadDepth = "Read Ahead Depth Can Not Be Negative";
+const char *Hash::DescriptorNotSupported = "File Descriptors Are Not Supported On This Platform";
+const char *Hash::IovNotSupported = "Scatter-Gather I/O Vectors Are Not Supported On This Platform";
+const char *Hash::OutputBufferTooShort = "Output Buffer Is Smaller Than The Hash Size";
+const char *Hash::DigestSizeMismatch = "Digest Size Does Not Match The Hash Size";
 
 #endif // !HLPHASH_H
@@ -17,6 +17,7 @@
 #define HLPHASHBUFFER_H
 
 #include <sstream>
+#include "HlpHashState.h"
 #include "../Utils/HlpHashLibTypes.h"
 
 
@@ -25,7 +26,10 @@ class HashBuffer
 public:
 	HashBuffer(const int32_t a_length)
 	{
-		data.resize(a_length);
+		if (a_length < 0 || a_length > MAX_LENGTH)
+			throw ArgumentOutOfRangeHashLibException(HashBuffer::InvalidLength);
+
+		data_length = a_length;
 		Initialize();
 	} // end constructor
 
@@ -34,16 +38,12 @@ public:
 
 	HashBuffer Clone() const
 	{
-		HashBuffer result = HashBuffer(0);
-		result.data = data;
-		result.pos = pos;
-
-		return result;
+		return *this;
 	}
 
-	bool Feed(const uint8_t *a_data, const int32_t a_length_a_data, const int32_t a_length)
+	bool Feed(const uint8_t *a_data, const int64_t a_length_a_data, const int64_t a_length)
 	{
-		int32_t Length;
+		int64_t Length;
 
 		if (a_length_a_data == 0)
 		{
@@ -55,7 +55,7 @@ public:
 			return false;
 		} // end if
 		
-		Length = data.size() - pos;
+		Length = int64_t(data_length) - pos;
 		if (Length > a_length)
 		{
 			Length = a_length;
@@ -63,15 +63,15 @@ public:
 		
 		memmove(&data[pos], &a_data[0], Length * sizeof(uint8_t));
 
-		pos = pos + Length;
+		pos = pos + int32_t(Length);
 
 		return GetIsFull();
 	} // end function Feed
 	
-	bool Feed(const uint8_t *a_data, const int32_t a_length_a_data,
-		int32_t &a_start_index, int32_t &a_length, uint64_t &a_processed_bytes)
+	bool Feed(const uint8_t *a_data, const int64_t a_length_a_data,
+		int64_t &a_start_index, int64_t &a_length, uint64_t &a_processed_bytes)
 	{
-		int32_t Length;
+		int64_t Length;
 
 		if (a_length_a_data == 0)
 		{
@@ -83,7 +83,7 @@ public:
 			return false;
 		} // end if
 		
-		Length = data.size() - pos;
+		Length = int64_t(data_length) - pos;
 		if (Length > a_length)
 		{
 			Length = a_length;
@@ -91,7 +91,7 @@ public:
 
 		memmove(&data[pos], &a_data[a_start_index], Length * sizeof(uint8_t));
 		
-		pos = pos + Length;
+		pos = pos + int32_t(Length);
 		a_start_index = a_start_index + Length;
 		a_length = a_length - Length;
 		a_processed_bytes = a_processed_bytes + uint64_t(Length);
@@ -102,14 +102,22 @@ public:
 	inline HashLibByteArray GetBytes()
 	{
 		pos = 0;
-		return data;
+		return HashLibByteArray(data, data + data_length);
 	} // end function GetBytes
+
+	// Like GetBytes, but hands out the buffer's own storage instead of a copy.
+	// The pointer is valid until the next Feed or Initialize.
+	inline const uint8_t * GetBytesInPlace()
+	{
+		pos = 0;
+		return data;
+	} // end function GetBytesInPlace
 	
 	inline HashLibByteArray GetBytesZeroPadded()
 	{
-		memset(&data[pos], 0, (data.size() - pos) * sizeof(uint8_t));
+		memset(&data[pos], 0, (data_length - pos) * sizeof(uint8_t));
 		pos = 0;
-		return data;
+		return HashLibByteArray(data, data + data_length);
 	} // end function GetBytesZeroPadded
 	
 	bool GetIsEmpty() const
@@ -119,12 +127,12 @@ public:
 	
 	bool GetIsFull() const
 	{
-		return pos == data.size();
+		return pos == data_length;
 	} // end function GetIsFull
 	
 	int32_t GetLength() const
 	{
-		return data.size();
+		return data_length;
 	} // end function GetLength
 	
 	int32_t GetPos() const
@@ -135,9 +143,26 @@ public:
 	void Initialize()
 	{
 		pos = 0;
-		memset(&data[0], 0, data.size() * sizeof(uint8_t));
+		memset(data, 0, data_length * sizeof(uint8_t));
 	} // end function Initialize
 	
+	void WriteState(HashStateWriter &a_writer) const
+	{
+		a_writer.Write(pos);
+		a_writer.Write(data, pos);
+	} // end function WriteState
+
+	void ReadState(HashStateReader &a_reader)
+	{
+		int32_t LPos;
+		a_reader.Read(LPos);
+		a_reader.Check(LPos >= 0 && LPos <= data_length);
+
+		Initialize();
+		a_reader.Read(data, LPos);
+		pos = LPos;
+	} // end function ReadState
+	
 	string ToString() const
 	{
 		stringstream ss;
@@ -148,11 +173,20 @@ public:
 	} // end function ToString
 	
 
+public:
+	// largest block size of any algorithm (the SHA3-224 rate); the storage is
+	// inline so a block hash and its pending block form one object
+	static const int32_t MAX_LENGTH = 144;
+
 private:
-	HashLibByteArray data;
-	int32_t pos;
+	static const char *InvalidLength;
+
+	uint8_t data[MAX_LENGTH];
+	int32_t data_length, pos;
 
 }; // end class HashBuffer
 
+const char *HashBuffer::InvalidLength = "HashBuffer Length Is Out Of Range";
+
 
 #endif // !HLPHASHBUFFER_H
\ No newline at end of file
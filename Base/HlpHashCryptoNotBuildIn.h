@@ -26,40 +26,39 @@ class BlockHash : public IIBlockHash, public Hash
 public:
 	BlockHash(const int32_t a_hash_size, const int32_t a_block_size,
 		int32_t a_buffer_size = -1)
-		: Hash(a_hash_size, a_block_size)
-	{
-		if (a_buffer_size == -1)
-			a_buffer_size = a_block_size;
-		
-		buffer = make_shared<HashBuffer>(a_buffer_size);
-	} // end constructor
+		: Hash(a_hash_size, a_block_size),
+		buffer(a_buffer_size == -1 ? a_block_size : a_buffer_size)
+	{} // end constructor
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
-		uint8_t* ptr_a_data = (uint8_t*)(&a_data[0]);
+		int64_t index = 0, LBlocks, LLength;
 
-		if (!buffer->GetIsEmpty())
+		if (!buffer.GetIsEmpty())
 		{
-			if (buffer->Feed(ptr_a_data, (int32_t)a_data.size(), a_index, a_length, processed_bytes))
+			if (buffer.Feed(a_data, a_length, index, a_length, processed_bytes))
 				TransformBuffer();
 		} // end if
 		
-		while (a_length >= buffer->GetLength())
+		if (a_length >= buffer.GetLength())
 		{
-			processed_bytes = processed_bytes + uint64_t(buffer->GetLength());
-			TransformBlock(ptr_a_data, buffer->GetLength(), a_index);
-			a_index = a_index + buffer->GetLength();
-			a_length = a_length - buffer->GetLength();
-		} // end while
+			LBlocks = a_length / buffer.GetLength();
+			LLength = LBlocks * buffer.GetLength();
+
+			processed_bytes = processed_bytes + uint64_t(LLength);
+			TransformBlocks(a_data + index, size_t(LBlocks));
+			index = index + LLength;
+			a_length = a_length - LLength;
+		} // end if
 			
 		if (a_length > 0)
-			buffer->Feed(ptr_a_data, (int32_t)a_data.size(), a_index, a_length, processed_bytes);
+			buffer.Feed(a_data, a_length, index, a_length, processed_bytes);
 
 	} // end function TransformBytes
 
 	virtual void Initialize()
 	{
-		buffer->Initialize();
+		buffer.Initialize();
 		processed_bytes = 0;
 	} // end function Initialize
 
@@ -77,10 +76,76 @@ public:
 		return make_shared<HashResult>(tempresult);
 	} // end function TransformFinal
 
+	virtual IHashResult ComputeUntyped(const void *a_data, const int64_t a_length)
+	{
+		uint8_t tempresult[HashValue::MAX_LENGTH];
+
+		if (a_length > int64_t(ONE_SHOT_BLOCKS) * buffer.GetLength()
+			|| GetHashSize() > int32_t(sizeof(tempresult)))
+			return Hash::ComputeUntyped(a_data, a_length);
+
+		ComputeInto(a_data, a_length, tempresult, sizeof(tempresult));
+
+		return make_shared<HashResult>(HashLibByteArray(tempresult, tempresult + GetHashSize()));
+	} // end function ComputeUntyped
+
+	virtual IHashResult ComputeBytes(const HashLibByteArray &a_data)
+	{
+		return ComputeUntyped(a_data.data(), (int64_t)a_data.size());
+	} // end function ComputeBytes
+
+	// Messages of at most ONE_SHOT_BLOCKS blocks are padded on the stack and
+	// compressed directly by algorithms that implement TransformOneShot,
+	// skipping the HashBuffer and the padding allocations of Finish. A
+	// negative length is left to TransformUntyped, which hashes it as empty.
+	virtual void ComputeInto(const void *a_data, const int64_t a_length,
+		uint8_t *a_output, const size_t a_output_length)
+	{
+		ValidateOutputLength(a_output_length);
+
+		if (a_data && a_length >= 0
+			&& a_length <= int64_t(ONE_SHOT_BLOCKS) * buffer.GetLength())
+		{
+			Initialize();
+
+			if (TransformOneShot((const uint8_t *)a_data, int32_t(a_length)))
+			{
+				GetResultInto(a_output);
+
+				Initialize();
+
+				return;
+			} // end if
+		} // end if
+
+		Hash::ComputeInto(a_data, a_length, a_output, a_output_length);
+	} // end function ComputeInto
+
+	virtual HashValue ComputeValue(const void *a_data, const int64_t a_length)
+	{
+		HashValue result;
+
+		result.SetLength(size_t(GetHashSize()));
+		ComputeInto(a_data, a_length, result.GetData(), result.GetLength());
+
+		return result;
+	} // end function ComputeValue
+
+	virtual void TransformFinalInto(uint8_t *a_output, const size_t a_output_length)
+	{
+		ValidateOutputLength(a_output_length);
+
+		Finish();
+
+		GetResultInto(a_output);
+
+		Initialize();
+	} // end function TransformFinalInto
+
 private:
 	inline void TransformBuffer()
 	{
-		TransformBlock(&buffer->GetBytes()[0], buffer->GetLength(), 0);
+		TransformBlock(buffer.GetBytesInPlace(), buffer.GetLength(), 0);
 	} // end function TransformBuffer
 
 	virtual void Finish() = 0;
@@ -89,9 +154,83 @@ private:
 		const int32_t a_data_length, const int32_t a_index) = 0;
 
 	virtual HashLibByteArray GetResult() = 0;
+
+	// Hashes a whole message of a_length bytes, starting from a freshly
+	// initialized state and leaving it ready for GetResult. Returns false,
+	// having done nothing, when the algorithm has no one-shot path or the
+	// padded message would not fit in ONE_SHOT_BLOCKS blocks.
+	virtual bool TransformOneShot(const uint8_t *a_data, const int32_t a_length)
+	{
+		(void)a_data;
+		(void)a_length;
+
+		return false;
+	} // end function TransformOneShot
+
+	// Writes GetResult() to a_output without building the array; overridden
+	// where the state can be serialized straight into caller memory.
+	virtual void GetResultInto(uint8_t *a_output)
+	{
+		HashLibByteArray tempresult = GetResult();
+
+		memmove(a_output, &tempresult[0], tempresult.size() * sizeof(uint8_t));
+	} // end function GetResultInto
 	
 protected:
-	shared_ptr<HashBuffer> buffer;
+	// Subclasses append their chaining values after calling these.
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		a_writer.Write(processed_bytes);
+		buffer.WriteState(a_writer);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		a_reader.Read(processed_bytes);
+		buffer.ReadState(a_reader);
+	} // end function ReadState
+
+	// Processes a_blocks consecutive blocks. Algorithms override this with a
+	// loop over their own TransformBlock so the per-block work is bound
+	// statically and can be inlined, instead of one virtual call per block.
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		register int32_t LBlockSize = buffer.GetLength();
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			TransformBlock(a_data + i * LBlockSize, LBlockSize, 0);
+	} // end function TransformBlocks
+
+	// Lays a_data out in a_blocks followed by Merkle-Damgard padding: 0x80,
+	// zeros, and the message length in bits in the last a_length_size bytes.
+	// Returns the number of blocks written, or 0 if more than
+	// ONE_SHOT_BLOCKS would be needed.
+	static int32_t PadMessage(const uint8_t *a_data, const int32_t a_length, uint8_t *a_blocks,
+		const int32_t a_block_size, const int32_t a_length_size, const bool a_big_endian)
+	{
+		register int32_t LCount, LSize;
+
+		LCount = (a_length + 1 + a_length_size + a_block_size - 1) / a_block_size;
+		if (LCount > ONE_SHOT_BLOCKS)
+			return 0;
+
+		LSize = LCount * a_block_size;
+
+		memmove(a_blocks, a_data, a_length * sizeof(uint8_t));
+		a_blocks[a_length] = 0x80;
+		memset(&a_blocks[a_length + 1], 0, (LSize - a_length - 1) * sizeof(uint8_t));
+
+		if (a_big_endian)
+			Converters::ReadUInt64AsBytesBE(uint64_t(a_length) * 8, a_blocks, LSize - 8);
+		else
+			Converters::ReadUInt64AsBytesLE(uint64_t(a_length) * 8, a_blocks, LSize - a_length_size);
+
+		return LCount;
+	} // end function PadMessage
+
+	static const int32_t ONE_SHOT_BLOCKS = 2;
+
+	HashBuffer buffer;
 	uint64_t processed_bytes;
 
 }; // end class BlockHash
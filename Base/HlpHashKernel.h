@@ -0,0 +1,89 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPHASHKERNEL_H
+#define HLPHASHKERNEL_H
+
+#include <initializer_list>
+#include "../Utils/HlpCpuFeatures.h"
+
+
+/// <summary>
+/// One implementation of the block function of an algorithm. A null
+/// "function" stands for the portable C++ code of the class itself.
+/// </summary>
+template <typename F>
+struct HashKernel
+{
+	const char *name;
+	// "CpuFeature" flags that must all be enabled
+	uint32_t features;
+	F function;
+
+}; // end struct HashKernel
+
+
+/// <summary>
+/// The kernels registered for an algorithm, fastest first and ending with
+/// the portable one, which needs no features. An instance calls "Select"
+/// once when it is created and keeps the kernel, so the hot path pays one
+/// indirect call and "GetKernelName()" reports what actually runs. A
+/// kernel forced through "CpuFeatures::SetForcedKernel" wins over faster
+/// ones as long as its features are enabled.
+/// </summary>
+template <typename F>
+class KernelTable
+{
+public:
+	KernelTable(initializer_list<HashKernel<F> > a_kernels)
+		: kernels(a_kernels)
+	{} // end constructor
+
+	const HashKernel<F> * Select() const
+	{
+		const uint32_t LEnabled = CpuFeatures::GetEnabled();
+		const string *LForced = CpuFeatures::PeekForcedKernel();
+
+		if (LForced != nullptr)
+		{
+			for (register size_t i = 0; i < kernels.size(); i++)
+			{
+				if (CpuFeatures::SameName(*LForced, kernels[i].name)
+					&& (kernels[i].features & LEnabled) == kernels[i].features)
+					return &kernels[i];
+			} // end for
+		} // end if
+
+		for (register size_t i = 0; i < kernels.size(); i++)
+		{
+			if ((kernels[i].features & LEnabled) == kernels[i].features)
+				return &kernels[i];
+		} // end for
+
+		return &kernels.back();
+	} // end function Select
+
+	inline const vector<HashKernel<F> > & GetKernels() const
+	{
+		return kernels;
+	} // end function GetKernels
+
+private:
+	vector<HashKernel<F> > kernels;
+
+}; // end class KernelTable
+
+
+#endif // !HLPHASHKERNEL_H
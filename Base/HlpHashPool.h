@@ -0,0 +1,222 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPHASHPOOL_H
+#define HLPHASHPOOL_H
+
+#include <map>
+#include "../Interfaces/HlpIHash.h"
+#include "../Interfaces/HlpIHashInfo.h"
+
+
+template <typename T>
+class HashPool;
+
+
+/// <summary>
+/// Owns an instance taken from a "HashPool" and hands it back to the free
+/// list of the releasing thread when it goes out of scope. Move only.
+/// </summary>
+template <typename T>
+class PooledHash
+{
+public:
+	typedef T (*Factory)();
+
+	PooledHash(T a_hash, const Factory a_factory)
+		: hash(::move(a_hash)), factory(a_factory)
+	{} // end constructor
+
+	PooledHash(PooledHash &&a_other)
+		: hash(::move(a_other.hash)), factory(a_other.factory)
+	{} // end constructor
+
+	~PooledHash()
+	{
+		if (hash)
+			HashPool<T>::Release(factory, ::move(hash));
+	} // end destructor
+
+	inline const T & operator->() const
+	{
+		return hash;
+	} // end function operator->
+
+	inline const T & Get() const
+	{
+		return hash;
+	} // end function Get
+
+	// Takes the instance out of the pool for good.
+	inline T Detach()
+	{
+		return ::move(hash);
+	} // end function Detach
+
+private:
+	PooledHash(const PooledHash &);
+	PooledHash & operator=(const PooledHash &);
+
+	T hash;
+	Factory factory;
+
+}; // end class PooledHash
+
+
+/// <summary>
+/// Per thread free lists of instances made by the zero argument factory
+/// functions of "HashLib4CPP". Acquiring from a non empty list costs an
+/// Initialize() instead of a heap allocation and a constructor, and no
+/// lock is taken since every thread only touches its own lists.
+/// </summary>
+template <typename T>
+class HashPool
+{
+public:
+	typedef T (*Factory)();
+
+	// The instance is Initialize()d and has the buffer size, file read mode,
+	// read ahead depth and, for keyed instances, the key of a fresh one.
+	static PooledHash<T> Acquire(const Factory a_factory)
+	{
+		FreeList *LList = GetFreeList(a_factory);
+		T LHash;
+
+		if (!LList)
+			LHash = a_factory();
+		else if (LList->hashes.empty())
+		{
+			LHash = a_factory();
+			SaveDefaults(LHash, *LList);
+			LList->has_defaults = true;
+		} // end else if
+		else
+		{
+			LHash = ::move(LList->hashes.back());
+			LList->hashes.pop_back();
+		} // end else
+
+		LHash->Initialize();
+
+		return PooledHash<T>(::move(LHash), a_factory);
+	} // end function Acquire
+
+	static void Release(const Factory a_factory, T &&a_hash)
+	{
+		FreeList *LList = GetFreeList(a_factory);
+
+		// a list that never created an instance, e.g. on a thread that only
+		// releases, does not know the defaults to reset to. Once the thread's
+		// lists are destroyed the instance is simply freed.
+		if (!LList || !LList->has_defaults || LList->hashes.size() >= MAX_FREE_LENGTH)
+			return;
+
+		RestoreDefaults(a_hash, *LList);
+		LList->hashes.push_back(::move(a_hash));
+	} // end function Release
+
+private:
+	struct FreeList
+	{
+		FreeList()
+			: buffer_size(0), read_ahead_depth(0), file_read_mode(FileReadStream),
+			has_defaults(false)
+		{} // end constructor
+
+		vector<T> hashes;
+		HashLibByteArray key;
+		int32_t buffer_size, read_ahead_depth;
+		FileReadMode file_read_mode;
+		bool has_defaults;
+	}; // end struct FreeList
+
+	enum ListsState { ListsUnset, ListsAlive, ListsDestroyed };
+
+	// Marks the thread's lists destroyed, so a "PooledHash" that outlives
+	// them (one with static storage, say) does not release into freed memory.
+	struct FreeLists
+	{
+		FreeLists()
+		{
+			GetListsState() = ListsAlive;
+		} // end constructor
+
+		~FreeLists()
+		{
+			GetListsState() = ListsDestroyed;
+		} // end destructor
+
+		map<Factory, FreeList> lists;
+	}; // end struct FreeLists
+
+	// trivially destructible, so still readable after the thread's
+	// thread_local destructors have run
+	static inline ListsState & GetListsState()
+	{
+		static thread_local ListsState LState = ListsUnset;
+
+		return LState;
+	} // end function GetListsState
+
+	// Returns nullptr once the calling thread's lists have been destroyed.
+	static FreeList * GetFreeList(const Factory a_factory)
+	{
+		if (GetListsState() == ListsDestroyed)
+			return nullptr;
+
+		static thread_local FreeLists LLists;
+
+		return &LLists.lists[a_factory];
+	} // end function GetFreeList
+
+	static inline void SaveDefaults(const T &a_hash, FreeList &a_list)
+	{
+		a_list.buffer_size = a_hash->GetBufferSize();
+		a_list.read_ahead_depth = a_hash->GetReadAheadDepth();
+		a_list.file_read_mode = a_hash->GetFileReadMode();
+		SaveKey(a_hash, a_list);
+	} // end function SaveDefaults
+
+	static inline void RestoreDefaults(T &a_hash, const FreeList &a_list)
+	{
+		a_hash->SetBufferSize(a_list.buffer_size);
+		a_hash->SetReadAheadDepth(a_list.read_ahead_depth);
+		a_hash->SetFileReadMode(a_list.file_read_mode);
+		RestoreKey(a_hash, a_list);
+	} // end function RestoreDefaults
+
+	static inline void SaveKey(const IHash &, FreeList &)
+	{} // end function SaveKey
+
+	static inline void SaveKey(const IHashWithKey &a_hash, FreeList &a_list)
+	{
+		a_list.key = a_hash->GetKey();
+	} // end function SaveKey
+
+	static inline void RestoreKey(IHash &, const FreeList &)
+	{} // end function RestoreKey
+
+	static inline void RestoreKey(IHashWithKey &a_hash, const FreeList &a_list)
+	{
+		a_hash->SetKey(a_list.key);
+	} // end function RestoreKey
+
+	// instances beyond this many per factory and thread are freed on release
+	static const size_t MAX_FREE_LENGTH = 16;
+
+}; // end class HashPool
+
+
+#endif // !HLPHASHPOOL_H
@@ -18,6 +18,7 @@
 
 #include "HlpConverters.h"
 #include "../Interfaces/HlpIHashResult.h"
+#include "../Utils/HlpMemoryResource.h"
 
 class HashResult : public IIHashResult
 {
@@ -30,11 +31,11 @@ private:
 
 public:
 	HashResult() 
-		: hash(HashLibByteArray(0))
+		: hash()
 	{} // end constructor
 
 	HashResult(const uint64_t a_hash)
-		: hash(HashLibByteArray(8))
+		: hash(8)
 	{
 		hash[0] = uint8_t(a_hash >> 56);
 		hash[1] = uint8_t(a_hash >> 48);
@@ -47,14 +48,16 @@ public:
 	} // end constructor
 	
 	HashResult(const HashLibByteArray &a_hash)
-	{
-		hash = HashLibByteArray(a_hash.size());
-		if (!hash.empty())
-			memmove(&hash[0], &a_hash[0], a_hash.size() * sizeof(uint8_t));		
-	} // end constructor
+		: hash(a_hash.begin(), a_hash.end())
+	{} // end constructor
+
+	// The bytes are stored in a_resource, e.g. a per request arena.
+	HashResult(const uint8_t *a_hash, const size_t a_length, MemoryResource &a_resource)
+		: hash(a_hash, a_hash + a_length, MemoryResourceAllocator<uint8_t>(&a_resource))
+	{} // end constructor
 	
 	HashResult(const uint32_t a_hash)
-		: hash(HashLibByteArray(4))
+		: hash(4)
 	{
 		hash[0] = uint8_t(a_hash >> 24);
 		hash[1] = uint8_t(a_hash >> 16);
@@ -63,20 +66,20 @@ public:
 	} // end constructor
 
 	HashResult(const uint8_t a_hash)
-		: hash(HashLibByteArray(1))
+		: hash(1)
 	{
 		hash[0] = a_hash;
 	} // end constructor
 	
 	HashResult(const uint16_t a_hash)
-		: hash(HashLibByteArray(2))
+		: hash(2)
 	{
 		hash[0] = uint8_t(a_hash >> 8);
 		hash[1] = uint8_t(a_hash);
 	} // end constructor
 	
 	HashResult(const int32_t a_hash)
-		: hash(HashLibByteArray(4))
+		: hash(4)
 	{
 		hash[0] = uint8_t(Bits::Asr32(a_hash, 24));
 		hash[1] = uint8_t(Bits::Asr32(a_hash, 16));
@@ -99,17 +102,27 @@ public:
 	
 	virtual bool CompareTo(const IHashResult &a_hashResult) const
 	{
-		return HashResult::SlowEquals(a_hashResult->GetBytes(), hash);
+		const HashResult *LOther = dynamic_cast<const HashResult *>(a_hashResult.get());
+		HashLibByteArray LBytes;
+
+		// another HashResult is compared in place, without copying either side
+		if (LOther)
+			return *this == *LOther;
+
+		LBytes = a_hashResult->GetBytes();
+
+		return HashResult::SlowEquals(LBytes.data(), LBytes.size(), hash.data(), hash.size());
 	} // end function CompareTo
 
 	bool operator==(const HashResult &a_hashResult) const
 	{
-		return HashResult::SlowEquals(a_hashResult.GetBytes(), hash);
+		return HashResult::SlowEquals(a_hashResult.hash.data(), a_hashResult.hash.size(),
+			hash.data(), hash.size());
 	} // end function operator==
 
 	virtual HashLibByteArray GetBytes() const
 	{
-		return hash;
+		return HashLibByteArray(hash.begin(), hash.end());
 	} // end function GetBytesAsVector
 
 	virtual inline int32_t GetHashCode() const
@@ -200,15 +213,38 @@ public:
 		
 		return diff == 0;
 	} // end function SlowEquals
+
+	static inline bool SlowEquals(const uint8_t *a_ar1, const size_t a_length1,
+		const uint8_t *a_ar2, const size_t a_length2)
+	{
+		register size_t diff = a_length1 ^ a_length2;
+		register size_t I = 0;
+
+		while (I < a_length1 && I < a_length2)
+		{
+			diff = diff | size_t(a_ar1[I] ^ a_ar2[I]);
+			I += 1;
+		} // end while
+
+		return diff == 0;
+	} // end function SlowEquals
 							
 	virtual inline string ToString(const bool a_group = false) const
 	{
-		return Converters::ConvertBytesToHexString(hash, a_group);
+		if (hash.empty()) return string("");
+		return Converters::ConvertBytesToHexString(&hash[0], uint32_t(hash.size()), a_group);
 	} // end function ToString
 			
 
+	// Builds the result object itself in a_resource as well as its bytes.
+	static IHashResult Create(const uint8_t *a_hash, const size_t a_length, MemoryResource &a_resource)
+	{
+		return allocate_shared<HashResult>(MemoryResourceAllocator<HashResult>(&a_resource),
+			a_hash, a_length, a_resource);
+	} // end function Create
+
 private:
-	HashLibByteArray hash;
+	HashLibResourceByteArray hash;
 
 }; // end class HashResult
 
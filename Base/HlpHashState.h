@@ -0,0 +1,243 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPHASHSTATE_H
+#define HLPHASHSTATE_H
+
+#include <cstring>
+#include "../Utils/HlpHashLibTypes.h"
+
+
+/// <summary>
+/// Encodes the internal state of a hash instance as a compact byte blob.
+/// The blob starts with a format version, the algorithm name and the hash
+/// size, followed by the algorithm specific fields. Integers are always
+/// stored little endian so a state can be resumed on another machine.
+/// </summary>
+class HashStateWriter
+{
+public:
+	HashStateWriter(const string &a_name, const int32_t a_hash_size)
+	{
+		if (a_name.size() > 255)
+			throw ArgumentHashLibException(HashStateWriter::NameTooLong);
+
+		Write(VERSION);
+		Write(uint8_t(a_name.size()));
+		data.insert(data.end(), a_name.begin(), a_name.end());
+		Write(a_hash_size);
+	} // end constructor
+
+	inline void Write(const uint8_t a_value)
+	{
+		data.push_back(a_value);
+	} // end function Write
+
+	inline void Write(const bool a_value)
+	{
+		Write(uint8_t(a_value ? 1 : 0));
+	} // end function Write
+
+	inline void Write(const uint32_t a_value)
+	{
+		for (register int32_t i = 0; i < 32; i += 8)
+			data.push_back(uint8_t(a_value >> i));
+	} // end function Write
+
+	inline void Write(const int32_t a_value)
+	{
+		Write(uint32_t(a_value));
+	} // end function Write
+
+	inline void Write(const uint64_t a_value)
+	{
+		Write(uint32_t(a_value));
+		Write(uint32_t(a_value >> 32));
+	} // end function Write
+
+	inline void Write(const uint8_t *a_data, const int32_t a_length)
+	{
+		data.insert(data.end(), a_data, a_data + a_length);
+	} // end function Write
+
+	template <typename T, size_t N>
+	inline void Write(const array<T, N> &a_value)
+	{
+		for (register size_t i = 0; i < N; i++)
+			Write(a_value[i]);
+	} // end function Write
+
+	template <typename T>
+	inline void Write(const vector<T> &a_value)
+	{
+		Write(uint32_t(a_value.size()));
+
+		for (register size_t i = 0; i < a_value.size(); i++)
+			Write(a_value[i]);
+	} // end function Write
+
+	inline const HashLibByteArray & GetBytes() const
+	{
+		return data;
+	} // end function GetBytes
+
+public:
+	static const uint8_t VERSION = 1;
+
+private:
+	static const char *NameTooLong;
+
+	HashLibByteArray data;
+
+}; // end class HashStateWriter
+
+
+/// <summary>
+/// Decodes a blob produced by "HashStateWriter". Every read is bounds
+/// checked and fixed size fields must match the receiving instance, so a
+/// truncated or foreign blob is rejected instead of corrupting the state.
+/// </summary>
+class HashStateReader
+{
+public:
+	HashStateReader(const HashLibByteArray &a_data, const string &a_name, const int32_t a_hash_size)
+		: data(a_data), pos(0)
+	{
+		uint8_t LVersion, LNameLength;
+		int32_t LHashSize;
+
+		Read(LVersion);
+		if (LVersion != HashStateWriter::VERSION)
+			throw ArgumentHashLibException(HashStateReader::UnsupportedVersion);
+
+		Read(LNameLength);
+		Require(LNameLength);
+
+		string LName = string(data.begin() + pos, data.begin() + pos + LNameLength);
+		pos = pos + LNameLength;
+
+		Read(LHashSize);
+		if (LName != a_name || LHashSize != a_hash_size)
+			throw ArgumentHashLibException(HashStateReader::ForeignState);
+	} // end constructor
+
+	inline void Read(uint8_t &a_value)
+	{
+		Require(1);
+		a_value = data[pos];
+		pos++;
+	} // end function Read
+
+	inline void Read(bool &a_value)
+	{
+		uint8_t LValue;
+		Read(LValue);
+
+		if (LValue > 1)
+			throw ArgumentHashLibException(HashStateReader::CorruptState);
+
+		a_value = LValue == 1;
+	} // end function Read
+
+	inline void Read(uint32_t &a_value)
+	{
+		Require(4);
+		a_value = 0;
+
+		for (register int32_t i = 0; i < 4; i++)
+			a_value = a_value | (uint32_t(data[pos + i]) << (i * 8));
+
+		pos = pos + 4;
+	} // end function Read
+
+	inline void Read(int32_t &a_value)
+	{
+		uint32_t LValue;
+		Read(LValue);
+		a_value = int32_t(LValue);
+	} // end function Read
+
+	inline void Read(uint64_t &a_value)
+	{
+		uint32_t LLow, LHigh;
+		Read(LLow);
+		Read(LHigh);
+		a_value = uint64_t(LLow) | (uint64_t(LHigh) << 32);
+	} // end function Read
+
+	inline void Read(uint8_t *a_data, const int32_t a_length)
+	{
+		Require(a_length);
+		memmove(a_data, &data[pos], a_length * sizeof(uint8_t));
+		pos = pos + a_length;
+	} // end function Read
+
+	template <typename T, size_t N>
+	inline void Read(array<T, N> &a_value)
+	{
+		for (register size_t i = 0; i < N; i++)
+			Read(a_value[i]);
+	} // end function Read
+
+	// the receiving vector must already have the stored size
+	template <typename T>
+	inline void Read(vector<T> &a_value)
+	{
+		uint32_t LSize;
+		Read(LSize);
+
+		if (LSize != a_value.size())
+			throw ArgumentHashLibException(HashStateReader::CorruptState);
+
+		for (register size_t i = 0; i < a_value.size(); i++)
+			Read(a_value[i]);
+	} // end function Read
+
+	// Rejects a value read from the blob that is out of range for the instance.
+	inline void Check(const bool a_condition) const
+	{
+		if (!a_condition)
+			throw ArgumentHashLibException(HashStateReader::CorruptState);
+	} // end function Check
+
+	// Call once all fields are read; trailing bytes mean a foreign blob.
+	inline void Finish() const
+	{
+		Check(pos == data.size());
+	} // end function Finish
+
+private:
+	inline void Require(const size_t a_length) const
+	{
+		if (a_length > data.size() - pos)
+			throw ArgumentHashLibException(HashStateReader::CorruptState);
+	} // end function Require
+
+	static const char *UnsupportedVersion;
+	static const char *ForeignState;
+	static const char *CorruptState;
+
+	const HashLibByteArray &data;
+	size_t pos;
+
+}; // end class HashStateReader
+
+const char *HashStateWriter::NameTooLong = "Algorithm Name Is Too Long To Be Stored In A Hash State";
+const char *HashStateReader::UnsupportedVersion = "Hash State Version Is Not Supported";
+const char *HashStateReader::ForeignState = "Hash State Belongs To A Different Algorithm";
+const char *HashStateReader::CorruptState = "Hash State Is Truncated Or Corrupt";
+
+
+#endif // !HLPHASHSTATE_H
@@ -0,0 +1,245 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library                                 
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald                 
+// *Github Repository <https://github.com/ron4fun>             
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE 
+// *or visit http ://www.opensource.org/licenses/mit-license.php.           
+
+// *Acknowledgements:                                  
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative        
+// *development of this library in Pascal/Delphi                         
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPHASHINGSTREAM_H
+#define HLPHASHINGSTREAM_H
+
+#include <ostream>
+#include <streambuf>
+#include <cstring>
+#include "../Interfaces/HlpIHash.h"
+
+
+/// <summary>
+/// Output "streambuf" that feeds every byte written through it to one or
+/// more hashes while forwarding it to an optional sink, so data can be
+/// written and digested in a single pass. Only the bytes the sink accepted
+/// are hashed. The hashes are used in place, not cloned.
+/// </summary>
+class HashingStreamBuf : public streambuf
+{
+public:
+	HashingStreamBuf(const IHash &a_hash, streambuf *a_sink = nullptr,
+		const int32_t a_buffer_size = BUFFER_SIZE)
+		: hashes(1, a_hash), sink(a_sink)
+	{
+		Setup(a_buffer_size);
+	} // end constructor
+
+	HashingStreamBuf(const HashLibHashArray &a_hashes, streambuf *a_sink = nullptr,
+		const int32_t a_buffer_size = BUFFER_SIZE)
+		: hashes(a_hashes), sink(a_sink)
+	{
+		Setup(a_buffer_size);
+	} // end constructor
+
+	~HashingStreamBuf()
+	{
+		Flush();
+	} // end destructor
+
+	/// <summary>
+	/// Flushes pending output and returns the digest of the first hash.
+	/// The hashes start over afterwards, like "IHash::TransformFinal".
+	/// </summary>
+	IHashResult TransformFinal()
+	{
+		return TransformFinalAll()[0];
+	} // end function TransformFinal
+
+	/// <summary>
+	/// Flushes pending output and returns the digest of every hash, in the
+	/// order they were given. Throws, leaving the hashes and the pending
+	/// bytes untouched, if the sink refuses part of the output, so the call
+	/// can be repeated once the sink accepts it.
+	/// </summary>
+	HashLibHashResultArray TransformFinalAll()
+	{
+		HashLibHashResultArray LResults = HashLibHashResultArray(hashes.size());
+
+		// finalizing now would leave the refused bytes to be hashed into
+		// the next message
+		if (!Flush())
+			throw InvalidOperationHashLibException(HashingStreamBuf::OutputRefused);
+
+		if (sink)
+			sink->pubsync();
+
+		for (size_t i = 0; i < hashes.size(); i++)
+			LResults[i] = hashes[i]->TransformFinal();
+
+		return LResults;
+	} // end function TransformFinalAll
+
+	inline streambuf * GetSink() const
+	{
+		return sink;
+	} // end function GetSink
+
+protected:
+	virtual int_type overflow(int_type a_char)
+	{
+		if (!Flush())
+			return traits_type::eof();
+
+		if (!traits_type::eq_int_type(a_char, traits_type::eof()))
+		{
+			*pptr() = traits_type::to_char_type(a_char);
+			pbump(1);
+		} // end if
+
+		return traits_type::not_eof(a_char);
+	} // end function overflow
+
+	virtual streamsize xsputn(const char *a_data, streamsize a_length)
+	{
+		streamsize LWritten;
+
+		if (a_length < epptr() - pptr())
+		{
+			memmove(pptr(), a_data, size_t(a_length));
+			pbump(int(a_length));
+
+			return a_length;
+		} // end if
+
+		if (!Flush())
+			return 0;
+
+		if (a_length < epptr() - pbase())
+		{
+			memmove(pptr(), a_data, size_t(a_length));
+			pbump(int(a_length));
+
+			return a_length;
+		} // end if
+
+		// writes of a whole buffer or more go straight to the sink and the
+		// hashes, uncopied
+		LWritten = sink ? sink->sputn(a_data, a_length) : a_length;
+		Feed(a_data, LWritten);
+
+		return LWritten;
+	} // end function xsputn
+
+	virtual int sync()
+	{
+		if (!Flush())
+			return -1;
+
+		return sink ? sink->pubsync() : 0;
+	} // end function sync
+
+private:
+	HashingStreamBuf(const HashingStreamBuf &);
+	HashingStreamBuf& operator=(const HashingStreamBuf &);
+
+	void Setup(const int32_t a_buffer_size)
+	{
+		if (hashes.empty() || a_buffer_size < 1)
+			throw ArgumentHashLibException(HashingStreamBuf::InvalidArguments);
+
+		for (size_t i = 0; i < hashes.size(); i++)
+		{
+			if (!hashes[i])
+				throw ArgumentNilHashLibException(HashingStreamBuf::InvalidArguments);
+
+			hashes[i]->Initialize();
+		} // end for
+
+		buffer.resize(a_buffer_size);
+		setp((char *)&buffer[0], (char *)&buffer[0] + buffer.size());
+	} // end function Setup
+
+	// Writes out the put area; false if the sink did not take all of it. The
+	// rejected bytes stay at the front of the put area for the next attempt.
+	bool Flush()
+	{
+		streamsize LLength, LWritten;
+
+		LLength = pptr() - pbase();
+		if (LLength == 0)
+			return true;
+
+		LWritten = sink ? sink->sputn(pbase(), LLength) : LLength;
+		Feed(pbase(), LWritten);
+
+		if (LWritten < LLength)
+			memmove(pbase(), pbase() + LWritten, size_t(LLength - LWritten));
+
+		setp(pbase(), epptr());
+		pbump(int(LLength - LWritten));
+
+		return LWritten == LLength;
+	} // end function Flush
+
+	void Feed(const char *a_data, const streamsize a_length)
+	{
+		for (size_t i = 0; i < hashes.size(); i++)
+			hashes[i]->TransformUntyped(a_data, int64_t(a_length));
+	} // end function Feed
+
+public:
+	static const char *InvalidArguments;
+	static const char *OutputRefused;
+
+private:
+	static const int32_t BUFFER_SIZE = int32_t(64 * 1024); // 64Kb
+
+	HashLibHashArray hashes;
+	streambuf *sink;
+	HashLibByteArray buffer;
+
+}; // end class HashingStreamBuf
+
+const char *HashingStreamBuf::InvalidArguments = "At Least One Hash And A Positive Buffer Size Are Required";
+const char *HashingStreamBuf::OutputRefused = "The Sink Refused Pending Output, Digest Not Finalized";
+
+
+/// <summary>
+/// "ostream" over a "HashingStreamBuf".
+/// </summary>
+class HashingOStream : public ostream
+{
+public:
+	HashingOStream(const IHash &a_hash, streambuf *a_sink = nullptr)
+		: ostream(nullptr), buffer(a_hash, a_sink)
+	{
+		rdbuf(&buffer);
+	} // end constructor
+
+	HashingOStream(const HashLibHashArray &a_hashes, streambuf *a_sink = nullptr)
+		: ostream(nullptr), buffer(a_hashes, a_sink)
+	{
+		rdbuf(&buffer);
+	} // end constructor
+
+	IHashResult TransformFinal()
+	{
+		return buffer.TransformFinal();
+	} // end function TransformFinal
+
+	HashLibHashResultArray TransformFinalAll()
+	{
+		return buffer.TransformFinalAll();
+	} // end function TransformFinalAll
+
+private:
+	HashingStreamBuf buffer;
+
+}; // end class HashingOStream
+
+
+#endif // !HLPHASHINGSTREAM_H
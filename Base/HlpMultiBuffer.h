@@ -0,0 +1,295 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPMULTIBUFFER_H
+#define HLPMULTIBUFFER_H
+
+#include <cstring>
+#include "HlpConverters.h"
+#include "HlpHashResult.h"
+#include "../Interfaces/HlpIHash.h"
+
+
+/// <summary>
+/// A block function that runs several independent messages side by side,
+/// one per SIMD lane. "compress" feeds a_count consecutive 64 byte blocks
+/// from a_blocks[l] into lane l, where word j of lane l lives at
+/// a_state[j * lanes + l]. A null "compress" stands for hashing the
+/// messages one at a time with the algorithm's own class.
+/// </summary>
+struct LaneKernel
+{
+	size_t lanes;
+	void (*compress)(uint32_t *a_state, const uint8_t *const *a_blocks, const size_t a_count);
+
+}; // end struct LaneKernel
+
+
+/// <summary>
+/// Drives a "LaneKernel" over a list of messages for a Merkle-Damgard
+/// hash with 64 byte blocks and 32-bit words (MD5, SHA-1, SHA-224/256).
+/// Every lane walks its message's whole blocks in place and then one or
+/// two padding blocks of its own; whenever a lane finishes, its digest is
+/// written out and the next message takes its place, so lanes stay busy
+/// whatever the mix of lengths.
+/// </summary>
+class MultiBuffer
+{
+public:
+	/// <summary>
+	/// What the driver needs to know about the algorithm.
+	/// </summary>
+	struct Algorithm
+	{
+		const uint32_t *initial_state;
+		int32_t state_words;
+		int32_t hash_size;
+		// SHA stores the bit length and the digest big endian, MD5 little
+		bool big_endian;
+
+	}; // end struct Algorithm
+
+	/// <summary>
+	/// Writes the digest of a_messages[i] to a_digests + i * hash_size.
+	/// </summary>
+	static void Run(const Algorithm &a_algorithm, const LaneKernel &a_kernel,
+		const HashLibSpan *a_messages, const size_t a_count, uint8_t *a_digests)
+	{
+		MultiBuffer LBuffer(a_algorithm, a_kernel, a_messages, a_count, a_digests);
+
+		LBuffer.Process();
+	} // end function Run
+
+	static void ValidateMessages(const HashLibSpan *a_messages, const size_t a_count)
+	{
+		for (register size_t i = 0; i < a_count; i++)
+		{
+			if (a_messages[i].length < 0 || (a_messages[i].length > 0 && !a_messages[i].data))
+				throw ArgumentHashLibException(MultiBuffer::InvalidMessage);
+		} // end for
+	} // end function ValidateMessages
+
+	/// <summary>
+	/// The fallback when no lane kernel is enabled: a_hash computes the
+	/// messages one after the other into the same layout as "Run".
+	/// </summary>
+	static void RunSerial(IIHash &a_hash, const HashLibSpan *a_messages, const size_t a_count,
+		uint8_t *a_digests)
+	{
+		const int32_t LHashSize = a_hash.GetHashSize();
+
+		for (register size_t i = 0; i < a_count; i++)
+			a_hash.ComputeInto(a_messages[i].data, a_messages[i].length,
+				a_digests + i * LHashSize, size_t(LHashSize));
+	} // end function RunSerial
+
+	/// <summary>
+	/// Splits a_count digests of a_hash_size bytes, laid out back to back,
+	/// into one result each.
+	/// </summary>
+	static HashLibHashResultArray ToResults(const HashLibByteArray &a_digests, const size_t a_count,
+		const int32_t a_hash_size)
+	{
+		HashLibHashResultArray LResults = HashLibHashResultArray(a_count);
+
+		for (register size_t i = 0; i < a_count; i++)
+			LResults[i] = make_shared<HashResult>(HashLibByteArray(a_digests.begin() + i * a_hash_size,
+				a_digests.begin() + (i + 1) * a_hash_size));
+
+		return LResults;
+	} // end function ToResults
+
+	/// <summary>
+	/// Reads 16 words from block a_block of every lane so that word t of
+	/// lane l lands at a_words[t * a_lanes + l], ready for vector loads.
+	/// </summary>
+	static inline void GatherWords(uint32_t *a_words, const uint8_t *const *a_blocks,
+		const size_t a_lanes, const size_t a_block, const bool a_big_endian)
+	{
+		for (register size_t l = 0; l < a_lanes; l++)
+		{
+			const uint32_t *LBlock = (const uint32_t *)(a_blocks[l] + a_block * 64);
+
+			for (register size_t t = 0; t < 16; t++)
+				a_words[t * a_lanes + l] = a_big_endian ? Converters::be2me_32(LBlock[t])
+					: Converters::le2me_32(LBlock[t]);
+		} // end for
+	} // end function GatherWords
+
+	static const size_t MAX_LANES = 16;
+	static const size_t MAX_STATE_WORDS = 8;
+
+private:
+	struct Lane
+	{
+		size_t message;
+		const uint8_t *next;
+		size_t blocks;
+		// padding blocks still to run once "blocks" is done
+		size_t tail_blocks;
+		uint8_t tail[128];
+
+	}; // end struct Lane
+
+	MultiBuffer(const Algorithm &a_algorithm, const LaneKernel &a_kernel,
+		const HashLibSpan *a_messages, const size_t a_count, uint8_t *a_digests)
+		: algorithm(a_algorithm), kernel(a_kernel), messages(a_messages),
+		count(a_count), digests(a_digests), pending(0), active(0)
+	{} // end constructor
+
+	void Process()
+	{
+		const uint8_t *LBlocks[MAX_LANES];
+		const uint8_t *LAny;
+		register size_t LRun;
+
+		for (register size_t l = 0; l < kernel.lanes; l++)
+			Start(l);
+
+		while (active > 0)
+		{
+			// every lane runs as far as the shortest current run allows;
+			// idle lanes repeat a busy lane's blocks and are ignored
+			LRun = ~size_t(0);
+			LAny = nullptr;
+			for (register size_t l = 0; l < kernel.lanes; l++)
+			{
+				if (lanes[l].next == nullptr)
+					continue;
+
+				LAny = lanes[l].next;
+				if (lanes[l].blocks < LRun)
+					LRun = lanes[l].blocks;
+			} // end for
+
+			for (register size_t l = 0; l < kernel.lanes; l++)
+				LBlocks[l] = (lanes[l].next != nullptr) ? lanes[l].next : LAny;
+
+			kernel.compress(state, LBlocks, LRun);
+
+			for (register size_t l = 0; l < kernel.lanes; l++)
+			{
+				Lane &LLane = lanes[l];
+
+				if (LLane.next == nullptr)
+					continue;
+
+				LLane.blocks = LLane.blocks - LRun;
+				if (LLane.blocks > 0)
+				{
+					LLane.next = LLane.next + LRun * 64;
+					continue;
+				} // end if
+
+				if (LLane.tail_blocks > 0)
+				{
+					LLane.next = LLane.tail;
+					LLane.blocks = LLane.tail_blocks;
+					LLane.tail_blocks = 0;
+					continue;
+				} // end if
+
+				Finish(l);
+				Start(l);
+			} // end for
+		} // end while
+	} // end function Process
+
+	void Start(const size_t a_lane)
+	{
+		Lane &LLane = lanes[a_lane];
+		register size_t LBody, LRemainder, LTail;
+		register uint64_t LBits;
+
+		if (pending == count)
+		{
+			LLane.next = nullptr;
+			return;
+		} // end if
+
+		LLane.message = pending;
+		pending++;
+		active++;
+
+		const HashLibSpan &LMessage = messages[LLane.message];
+		LBody = size_t(LMessage.length / 64);
+		LRemainder = size_t(LMessage.length % 64);
+		LTail = (LRemainder < 56) ? 64 : 128;
+
+		if (LRemainder > 0)
+			memcpy(LLane.tail, LMessage.data + LBody * 64, LRemainder);
+		LLane.tail[LRemainder] = 0x80;
+		memset(&LLane.tail[LRemainder + 1], 0, LTail - LRemainder - 9);
+
+		LBits = uint64_t(LMessage.length) << 3;
+		if (algorithm.big_endian)
+			Converters::ReadUInt64AsBytesBE(LBits, LLane.tail, int32_t(LTail - 8));
+		else
+			Converters::ReadUInt64AsBytesLE(LBits, LLane.tail, int32_t(LTail - 8));
+
+		if (LBody > 0)
+		{
+			LLane.next = LMessage.data;
+			LLane.blocks = LBody;
+			LLane.tail_blocks = LTail / 64;
+		} // end if
+		else
+		{
+			LLane.next = LLane.tail;
+			LLane.blocks = LTail / 64;
+			LLane.tail_blocks = 0;
+		} // end else
+
+		for (register int32_t j = 0; j < algorithm.state_words; j++)
+			state[j * kernel.lanes + a_lane] = algorithm.initial_state[j];
+	} // end function Start
+
+	void Finish(const size_t a_lane)
+	{
+		uint8_t *LDigest = digests + lanes[a_lane].message * algorithm.hash_size;
+		register uint32_t LWord;
+
+		for (register int32_t j = 0; j < algorithm.hash_size / 4; j++)
+		{
+			LWord = state[j * kernel.lanes + a_lane];
+			if (algorithm.big_endian)
+				Converters::ReadUInt32AsBytesBE(LWord, LDigest, j * 4);
+			else
+			{
+				for (register int32_t k = 0; k < 4; k++)
+					LDigest[j * 4 + k] = uint8_t(LWord >> (k * 8));
+			} // end else
+		} // end for
+
+		active--;
+	} // end function Finish
+
+	const Algorithm &algorithm;
+	const LaneKernel &kernel;
+	const HashLibSpan *messages;
+	size_t count;
+	uint8_t *digests;
+	size_t pending, active;
+	alignas(64) uint32_t state[MAX_STATE_WORDS * MAX_LANES];
+	Lane lanes[MAX_LANES];
+
+	static const char *InvalidMessage;
+
+}; // end class MultiBuffer
+
+const char *MultiBuffer::InvalidMessage = "A message has a negative length or no data";
+
+
+#endif // !HLPMULTIBUFFER_H
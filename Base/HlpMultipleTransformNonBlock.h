@@ -35,17 +35,16 @@ public:
 		_list.clear();
 	} // end fucntion Initialize
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
-		const HashLibByteArray::const_iterator start = a_data.begin() + a_index;
-		const HashLibByteArray::const_iterator end = start + a_length;
-
-		_list.push_back(HashLibByteArray(start, end));
+		if (a_data && a_length > 0)
+			_list.push_back(HashLibByteArray(a_data, a_data + a_length));
 	} // end function TransformBytes
 
 	virtual IHashResult TransformFinal()
 	{
-		IHashResult result = ComputeAggregatedBytes(Aggregate());
+		HashLibByteArray data = Aggregate();
+		IHashResult result = ComputeAggregatedBytes(data.data(), (int64_t)data.size());
 
 		Initialize();
 
@@ -56,20 +55,33 @@ public:
 	{
 		Initialize();
 	
-		return ComputeAggregatedBytes(a_data);
+		return ComputeAggregatedBytes(a_data.data(), (int64_t)a_data.size());
 	} // end function ComputeBytes
 
+	virtual IHashResult ComputeUntyped(const void *a_data, const int64_t a_length)
+	{
+		// the whole message is needed at once, so hash it in place instead of
+		// collecting it into _list first. Like TransformUntyped, a null or
+		// non-positive message is hashed as empty.
+		Initialize();
+
+		if (!a_data || a_length <= 0)
+			return TransformFinal();
+
+		return ComputeAggregatedBytes((const uint8_t *)a_data, a_length);
+	} // end function ComputeUntyped
+
 protected:
-	virtual IHashResult ComputeAggregatedBytes(const HashLibByteArray &a_data) = 0;
+	virtual IHashResult ComputeAggregatedBytes(const uint8_t *a_data, const int64_t a_length) = 0;
 
 private:
 	HashLibByteArray Aggregate()
 	{
-		register uint32_t sum = 0, index = 0;
+		register size_t sum = 0, index = 0;
 		
 		for (register uint32_t i = 0; i < _list.size(); i++)
 		{
-			sum = sum + (uint32_t)(_list)[i].size();
+			sum = sum + (_list)[i].size();
 		} // end for
 		
 		HashLibByteArray result = HashLibByteArray(sum);
@@ -77,7 +89,7 @@ private:
 		for (register uint32_t i = 0; i < _list.size(); i++) 
 		{
 			memmove(&result[index], &(_list)[i][0], (_list)[i].size() * sizeof(uint8_t));
-			index = index + (uint32_t)(_list)[i].size();
+			index = index + (_list)[i].size();
 		} // end for
 
 		return result;
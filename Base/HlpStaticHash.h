@@ -0,0 +1,83 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPSTATICHASH_H
+#define HLPSTATICHASH_H
+
+#include "HlpHash.h"
+
+
+/// <summary>
+/// Value type wrapper around the algorithm "T", meant to live on the stack
+/// or inside another object instead of behind an "IHash". The class is
+/// final and its members call "T" by qualified name, so they are bound at
+/// compile time, and since the dynamic type of the object is known the
+/// compiler can also devirtualize and inline the calls "T" makes on itself.
+/// No reference count is involved. The instance is ready to use once
+/// constructed.
+/// </summary>
+template <typename T>
+class StaticHash final : public T
+{
+public:
+	StaticHash()
+		: T()
+	{
+		T::Initialize();
+	} // end constructor
+
+	// For algorithms configured at construction, e.g. Blake2B.
+	template <typename A>
+	explicit StaticHash(const A &a_argument)
+		: T(a_argument)
+	{
+		T::Initialize();
+	} // end constructor
+
+	inline int32_t GetHashSize() const
+	{
+		return T::GetHashSize();
+	} // end function GetHashSize
+
+	inline void Reset()
+	{
+		T::Initialize();
+	} // end function Reset
+
+	inline void Update(const void *a_data, const int64_t a_length)
+	{
+		T::TransformBytes((const uint8_t *)a_data, a_length);
+	} // end function Update
+
+	// Writes GetHashSize() bytes to a_output and resets the instance.
+	inline void Final(uint8_t *a_output)
+	{
+		T::TransformFinalInto(a_output, size_t(T::GetHashSize()));
+	} // end function Final
+
+	inline HashValue FinalValue()
+	{
+		return T::TransformFinalValue();
+	} // end function FinalValue
+
+	inline void Compute(const void *a_data, const int64_t a_length, uint8_t *a_output)
+	{
+		T::ComputeInto(a_data, a_length, a_output, size_t(T::GetHashSize()));
+	} // end function Compute
+
+}; // end class StaticHash
+
+
+#endif // !HLPSTATICHASH_H
@@ -29,6 +29,14 @@ public:
 		name = __func__;
 	} // end constructor
 	
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Adler32 &LSource = GetStateSource<Adler32>(a_source);
+
+		a = LSource.a;
+		b = LSource.b;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		Adler32 HashInstance;
@@ -58,9 +66,10 @@ public:
 		return result;
 	} // end function TransformFinal
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
 		register int32_t n;
+		register int64_t i = 0;
 
 		// lifted from PngEncoder Adler32.cs
 
@@ -71,15 +80,15 @@ public:
 			// b maximally grows by3800 * median(a) = 2090079800 < 2^31
 			n = 3800;
 			if (n > a_length)
-				n  = a_length;
+				n  = int32_t(a_length);
 			
 			a_length = a_length - n;
 
 			while ((n - 1) >= 0)
 			{
-				a = (a + a_data[a_index]);
+				a = (a + a_data[i]);
 				b = (b + a);
-				a_index++;
+				i++;
 				n--;
 			} // end while
 
@@ -43,6 +43,12 @@ public:
 			hash_size = 2;
 			block_size = 1;
 		} // end else if
+		else if (_Width >= 17 && _Width <= 23 && _Width != 21)
+		{
+			// TransformFinal emits these widths as a 16-bit value
+			hash_size = 2;
+			block_size = 1;
+		} // end else if
 		else if (_Width >= 17 && _Width <= 39)
 		{
 			hash_size = 4;
@@ -70,6 +76,28 @@ public:
 		//	delete CRCTable;
 	} // end destructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const CRC &LSource = GetStateSource<CRC>(a_source);
+
+		Names = LSource.Names;
+		Width = LSource.Width;
+		Polynomial = LSource.Polynomial;
+		Init = LSource.Init;
+		XorOut = LSource.XorOut;
+		CheckValue = LSource.CheckValue;
+		CRCMask = LSource.CRCMask;
+		CRCHighBitMask = LSource.CRCHighBitMask;
+		ReflectIn = LSource.ReflectIn;
+		ReflectOut = LSource.ReflectOut;
+		IsTableGenerated = LSource.IsTableGenerated;
+		CRCTable = LSource.CRCTable;
+		ptr_Fm_CRCTable = LSource.ptr_Fm_CRCTable;
+		block_size = LSource.block_size;
+		hash_size = LSource.hash_size;
+		hash = LSource.hash;
+	} // end function CopyStateFrom
+
 	virtual ICRC CloneCRC() const
 	{
 		CRC HashInstance = CRC(Width, Polynomial, Init, ReflectIn, ReflectOut, XorOut, CheckValue, Names);
@@ -165,20 +193,16 @@ public:
 		return IHashResult(new HashResult(LUInt64));
 	} // end function TransformFinal
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
 		// table driven CRC reportedly only works for 8, 16, 24, 32 bits
 		// HOWEVER, it seems to work for everything > 7 bits, so use it
 		// accordingly
 
-		int32_t i = a_index;
-
-		uint8_t *ptr_a_data = (uint8_t *)&a_data[0];
-
 		if (Width > Delta)
-			CalculateCRCbyTable(ptr_a_data, a_length, i);
+			CalculateCRCbyTable(a_data, a_length, 0);
 		else
-			CalculateCRCdirect(ptr_a_data, a_length, i);
+			CalculateCRCdirect(a_data, a_length, 0);
 		
 	} // end function TransformBytes
 
@@ -614,9 +638,9 @@ private:
 	} // end function GenerateTable
 
 	// tables work only for 8, 16, 24, 32 bit CRC
-	void CalculateCRCbyTable(const uint8_t * a_data, const int32_t a_data_length, const int32_t a_index)
+	void CalculateCRCbyTable(const uint8_t * a_data, const int64_t a_data_length, const int64_t a_index)
 	{
-		int32_t Length, i;
+		int64_t Length, i;
 		uint64_t tmp;
 		
 		Length = a_data_length;
@@ -648,9 +672,9 @@ private:
 
 	// fast bit by bit algorithm without augmented zero bytes.
 	// does not use lookup table, suited for polynomial orders between 1...32.
-	void CalculateCRCdirect(const uint8_t *a_data, const int32_t a_data_length, const int32_t a_index)
+	void CalculateCRCdirect(const uint8_t *a_data, const int64_t a_data_length, const int64_t a_index)
 	{
-		int32_t Length, i;
+		int64_t Length, i;
 		register uint64_t c, bit, j;
 		
 		Length = a_data_length;
@@ -710,6 +734,16 @@ protected:
 		return hash_size;
 	} // end function GetHashSize
 
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		a_writer.Write(hash);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		a_reader.Read(hash);
+	} // end function ReadState
+
 private:
 	int32_t block_size;
 	int32_t hash_size;
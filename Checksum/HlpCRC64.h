@@ -33,33 +33,47 @@ public:
 	_CRC64(const uint64_t _poly, const uint64_t _Init,
 		const bool _refIn, const bool _refOut, const uint64_t _XorOut,
 		const uint64_t _check, const HashLibStringArray &_Names)
-		: Hash(8, 1)
+		: Hash(8, 1), CRCAlgorithm(64, _poly, _Init, _refIn, _refOut, _XorOut, _check, _Names)
 	{
 		name = __func__;
-
-		CRCAlgorithm = ::move(ICRC(new CRC(64, _poly, _Init, _refIn, _refOut, _XorOut, _check, _Names)));
 	} // end constructor
 
 	~_CRC64()
 	{} // end destructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		CRCAlgorithm.CopyStateFrom(GetStateSource<_CRC64>(a_source).CRCAlgorithm);
+	} // end function CopyStateFrom
+
+	virtual HashLibByteArray SaveState() const
+	{
+		return CRCAlgorithm.SaveState();
+	} // end function SaveState
+
+	virtual void RestoreState(const HashLibByteArray &a_state)
+	{
+		CRCAlgorithm.RestoreState(a_state);
+	} // end function RestoreState
+
 	virtual void Initialize()
 	{
-		CRCAlgorithm->Initialize();
+		CRCAlgorithm.Initialize();
 	} // end function Initialize
 
 	virtual IHashResult TransformFinal()
 	{
-		return CRCAlgorithm->TransformFinal();
+		return CRCAlgorithm.TransformFinal();
 	} // end function TransformFinal
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
-		CRCAlgorithm->TransformBytes(a_data, a_index, a_length);
+		CRCAlgorithm.TransformBytes(a_data, a_length);
 	} // end function TransformBytes
 
 private:
-	ICRC CRCAlgorithm;
+	// held by value, so copying the wrapper copies the running CRC too
+	CRC CRCAlgorithm;
 
 }; // end class CRC64
 
@@ -52,14 +52,32 @@ public:
 
 		FHashSize = Lconfig->GetHashSize();
 
-		state.resize(8);
-		m.resize(16);
+		state.fill(0);
+		m.fill(0);
 
 		// Set the Inherited Hash variables
 		hash_size = FHashSize;
 		block_size = BlockSize;
 	}
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Blake2S &LSource = GetStateSource<Blake2S>(a_source);
+
+		m = LSource.m;
+		rawConfig = LSource.rawConfig;
+		state = LSource.state;
+		Key = LSource.Key;
+		buf = LSource.buf;
+		bufferFilled = LSource.bufferFilled;
+		counter0 = LSource.counter0;
+		counter1 = LSource.counter1;
+		finalizationFlag0 = LSource.finalizationFlag0;
+		finalizationFlag1 = LSource.finalizationFlag1;
+		FHashSize = LSource.FHashSize;
+		hash_size = LSource.hash_size;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		Blake2S HashInstance = Blake2S(make_shared<Blake2SConfig>(FHashSize));
@@ -107,8 +125,6 @@ public:
 
 		bufferFilled = 0;
 
-		buf.resize(BlockSizeInBytes);
-
 		memset(&buf[0], 0, buf.size() * sizeof(uint8_t));
 
 		memset(&m[0], uint32_t(0), sizeof(m));
@@ -116,18 +132,17 @@ public:
 		for (i = 0; i < 8; i++) state[i] = state[i] ^ rawConfig[i];
 
 		if (!Key.empty())
-			TransformBytes(Key, 0, Key.size());
+			TransformBytes(&Key[0], (int32_t)Key.size());
 	}
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, const int32_t _a_index, const int32_t _a_data_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_data_length)
 	{
 		register size_t offset, bufferRemaining;
-		int32_t a_index = _a_index, a_data_length = _a_data_length;
 
-		offset = a_index;
+		offset = 0;
 		bufferRemaining = BlockSizeInBytes - bufferFilled;
 
-		if ((bufferFilled > 0) && (a_data_length > bufferRemaining))
+		if ((bufferFilled > 0) && (a_data_length > int64_t(bufferRemaining)))
 		{
 			memmove(&buf[bufferFilled], &a_data[offset], bufferRemaining);
 			counter0 = counter0 + uint32_t(BlockSizeInBytes);
@@ -136,7 +151,7 @@ public:
 			
 			Compress(&buf[0], 0);
 			offset = offset + bufferRemaining;
-			a_data_length = a_data_length - bufferRemaining;
+			a_data_length = a_data_length - int64_t(bufferRemaining);
 			bufferFilled = 0;
 		}
 
@@ -146,15 +161,15 @@ public:
 			if (counter0 == 0)
 				counter1++;
 			
-			Compress(&a_data[0], offset);
+			Compress(a_data + offset, 0);
 			offset = offset + BlockSizeInBytes;
 			a_data_length = a_data_length - BlockSizeInBytes;
 		}
 		
 		if (a_data_length > 0)
 		{
-			memmove(&buf[bufferFilled], &a_data[offset], a_data_length);
-			bufferFilled = bufferFilled + a_data_length;
+			memmove(&buf[bufferFilled], &a_data[offset], size_t(a_data_length));
+			bufferFilled = bufferFilled + int32_t(a_data_length);
 		}
 
 	}
@@ -176,12 +191,49 @@ public:
 		return result;
 	}
 
+	virtual void TransformFinalInto(uint8_t *a_output, const size_t a_output_length)
+	{
+		uint8_t tempRes[32];
+
+		ValidateOutputLength(a_output_length);
+
+		Finish();
+
+		Converters::le32_copy(&state[0], 0, tempRes, 0, sizeof(tempRes));
+		memmove(a_output, tempRes, FHashSize * sizeof(uint8_t));
+
+		Initialize();
+	}
+
 protected:
 	virtual string GetName() const
 	{
 		return Utils::string_format("%s_%u", name, FHashSize * 8);
 	}	
 
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		a_writer.Write(state);
+		a_writer.Write(buf);
+		a_writer.Write(bufferFilled);
+		a_writer.Write(counter0);
+		a_writer.Write(counter1);
+		a_writer.Write(finalizationFlag0);
+		a_writer.Write(finalizationFlag1);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		a_reader.Read(state);
+		a_reader.Read(buf);
+		a_reader.Read(bufferFilled);
+		a_reader.Check(bufferFilled >= 0 && bufferFilled <= int32_t(buf.size()));
+		a_reader.Read(counter0);
+		a_reader.Read(counter1);
+		a_reader.Read(finalizationFlag0);
+		a_reader.Read(finalizationFlag1);
+	} // end function ReadState
+
 private:
 	void Compress(const uint8_t *block, const int32_t start)
 	{
@@ -1394,8 +1446,11 @@ private:
 	}
 
 private:
-	HashLibUInt32Array m, rawConfig, state;
-	HashLibByteArray Key, buf;
+	array<uint32_t, 16> m;
+	array<uint32_t, 8> state;
+	array<uint8_t, 64> buf;
+	HashLibUInt32Array rawConfig;
+	HashLibByteArray Key;
 	int32_t bufferFilled, FHashSize, BlockSize;
 	uint32_t counter0, counter1, finalizationFlag0, finalizationFlag1;
 	
@@ -37,33 +37,33 @@ public:
 
 	} // end function Initialize
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, const int32_t _a_index, const int32_t _a_data_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_data_length)
 	{
-		int32_t a_index = _a_index, a_data_length = _a_data_length;
+		int64_t index = 0;
 
 		while ((bOff != 64) && (a_data_length > 0))
 		{
-			InternalUpdate(a_data[a_index]);
-			a_index++;
+			InternalUpdate(a_data[index]);
+			index++;
 			a_data_length--;
 		}
 
 		while (a_data_length >= 64)
 		{
-			memmove(&tmp[0], &a_data[a_index], 64 * sizeof(uint8_t));
+			memmove(&tmp[0], &a_data[index], 64 * sizeof(uint8_t));
 			reverse(tmp, block);
 			g_N(h, N, block);
 			addMod512(N, 512);
 			addMod512(Sigma, block);
 
 			a_data_length = a_data_length - 64;
-			a_index = a_index + 64;
+			index = index + 64;
 		}
 
 		while (a_data_length > 0)
 		{
-			InternalUpdate(a_data[a_index]);
-			a_index++;
+			InternalUpdate(a_data[index]);
+			index++;
 			a_data_length--;
 		}
 		
@@ -1607,6 +1607,21 @@ public:
 		name = __func__;
 	}
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const GOST3411_2012_256 &LSource = GetStateSource<GOST3411_2012_256>(a_source);
+
+		IV = LSource.IV;
+		N = LSource.N;
+		Sigma = LSource.Sigma;
+		Ki = LSource.Ki;
+		m = LSource.m;
+		h = LSource.h;
+		tmp = LSource.tmp;
+		block = LSource.block;
+		bOff = LSource.bOff;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		GOST3411_2012_256 HashInstance = GOST3411_2012_256();
@@ -1661,6 +1676,21 @@ public:
 		name = __func__;
 	}
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const GOST3411_2012_512 &LSource = GetStateSource<GOST3411_2012_512>(a_source);
+
+		IV = LSource.IV;
+		N = LSource.N;
+		Sigma = LSource.Sigma;
+		Ki = LSource.Ki;
+		m = LSource.m;
+		h = LSource.h;
+		tmp = LSource.tmp;
+		block = LSource.block;
+		bOff = LSource.bOff;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		GOST3411_2012_512 HashInstance = GOST3411_2012_512();
@@ -34,6 +34,16 @@ public:
 		s.resize(8);
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Gost &LSource = GetStateSource<Gost>(a_source);
+
+		state = LSource.state;
+		hash = LSource.hash;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		Gost HashInstance;
@@ -41,7 +51,7 @@ public:
 		HashInstance = Gost();
 		HashInstance.state = state;
 		HashInstance.hash = hash;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash Hash = make_shared<Gost>(HashInstance);
@@ -335,14 +345,29 @@ private:
 	} // end function Compress
 
 protected:
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(state);
+		a_writer.Write(hash);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(state);
+		a_reader.Read(hash);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
 		uint64_t bits = processed_bytes * 8;
 
-		if (buffer->GetPos() > 0)
+		if (buffer.GetPos() > 0)
 		{
-			HashLibByteArray pad = HashLibByteArray(32 - buffer->GetPos());
-			TransformBytes(pad, 0, 32 - buffer->GetPos());
+			uint8_t pad[32];
+			memset(pad, 0, (32 - buffer.GetPos()) * sizeof(uint8_t));
+			TransformBytes(&pad[0], 32 - buffer.GetPos());
 		} // end if
 
 		HashLibUInt32Array length = HashLibUInt32Array(8);
@@ -364,8 +389,16 @@ protected:
 		return result;
 	} // end function GetResult
 
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		register int32_t LBlockSize = buffer.GetLength();
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			Gost::TransformBlock(a_data + i * LBlockSize, LBlockSize, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
 	{
 		register uint32_t c, a, b;
 
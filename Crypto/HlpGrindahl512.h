@@ -32,6 +32,16 @@ public:
 
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Grindahl512 &LSource = GetStateSource<Grindahl512>(a_source);
+
+		state = LSource.state;
+		temp = LSource.temp;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		Grindahl512 HashInstance;
@@ -39,7 +49,7 @@ public:
 		HashInstance = Grindahl512();
 		HashInstance.state = state;
 		HashInstance.temp = temp;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<Grindahl512>(HashInstance);
@@ -57,12 +67,25 @@ public:
 	} // end function Initialize
 
 protected:
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(state);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(state);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
 		int32_t padding_size = 16 - int32_t(processed_bytes & 7);
 		uint64_t msg_length = (processed_bytes >> 3) + 1;
 
-		HashLibByteArray pad = HashLibByteArray(padding_size);
+		uint8_t pad[16];
+		memset(pad, 0, padding_size * sizeof(uint8_t));
 
 		pad[0] = 0x80;
 
@@ -70,7 +93,7 @@ protected:
 
 		Converters::ReadUInt64AsBytesLE(msg_length, pad, padding_size - 8);
 
-		TransformBytes(pad, 0, padding_size - 8);
+		TransformBytes(&pad[0], padding_size - 8);
 
 		state[0] = Converters::ReadBytesAsUInt64LE(&pad[0], padding_size - 8);
 
@@ -94,8 +117,16 @@ protected:
 		return result;
 	} // end function GetResult
 
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		register int32_t LBlockSize = buffer.GetLength();
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			Grindahl512::TransformBlock(a_data + i * LBlockSize, LBlockSize, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
 	{
 		state[0] = Converters::ReadBytesAsUInt64LE(a_data, a_index);
 
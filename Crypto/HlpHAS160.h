@@ -27,17 +27,26 @@ public:
 	{
 		name = __func__;
 
-		hash.resize(5);
-		data.resize(20);
+		hash.fill(0);
+		data.fill(0);
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const HAS160 &LSource = GetStateSource<HAS160>(a_source);
+
+		hash = LSource.hash;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		HAS160 HashInstance;
 
 		HashInstance = HAS160();
 		HashInstance.hash = hash;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<HAS160>(HashInstance);
@@ -58,17 +67,30 @@ public:
 	} // end function Initialize
 
 protected:
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(hash);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(hash);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
 		int32_t pad_index;
 
 		uint64_t bits = processed_bytes * 8;
-		if (buffer->GetPos() < 56)
-			pad_index = 56 - buffer->GetPos();
+		if (buffer.GetPos() < 56)
+			pad_index = 56 - buffer.GetPos();
 		else
-			pad_index = 120 - buffer->GetPos();
+			pad_index = 120 - buffer.GetPos();
 
-		HashLibByteArray pad = HashLibByteArray(pad_index + 8);
+		uint8_t pad[128];
+		memset(pad, 0, (pad_index + 8) * sizeof(uint8_t));
 
 		pad[0] = 0x80;
 
@@ -78,7 +100,7 @@ protected:
 
 		pad_index = pad_index + 8;
 
-		TransformBytes(pad, 0, pad_index);
+		TransformBytes(&pad[0], pad_index);
 
 	} // end function Finish
 	
@@ -91,8 +113,16 @@ protected:
 		return result;
 	} // end function GetResult
 		
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		register int32_t LBlockSize = buffer.GetLength();
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			HAS160::TransformBlock(a_data + i * LBlockSize, LBlockSize, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
 	{
 		register uint32_t A, B, C, D, E, T;
 
@@ -183,8 +213,8 @@ protected:
 	} // end function TransformBlock
 
 private:
-	HashLibUInt32Array hash;
-	HashLibUInt32Array data;
+	array<uint32_t, 5> hash;
+	array<uint32_t, 20> data;
 
 	static const int32_t rot[20]; 
 	static const int32_t tor[20];
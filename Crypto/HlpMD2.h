@@ -32,6 +32,16 @@ public:
 		checksum.resize(16);
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const MD2 &LSource = GetStateSource<MD2>(a_source);
+
+		state = LSource.state;
+		checksum = LSource.checksum;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		MD2 HashInstance;
@@ -39,7 +49,7 @@ public:
 		HashInstance = MD2();
 		HashInstance.state = state;
 		HashInstance.checksum = checksum;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<MD2>(HashInstance);
@@ -57,12 +67,27 @@ public:
 	} // end function Initialize
 
 protected:
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(state);
+		a_writer.Write(checksum);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(state);
+		a_reader.Read(checksum);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
 		uint32_t padLen;
 
-		padLen = 16 - buffer->GetPos();
-		HashLibByteArray pad = HashLibByteArray(padLen);
+		padLen = 16 - buffer.GetPos();
+		uint8_t pad[16];
+		memset(pad, 0, padLen * sizeof(uint8_t));
 
 		register uint32_t i = 0;
 		while (i < padLen)
@@ -71,8 +96,8 @@ protected:
 			i++;
 		} // end while
 		
-		TransformBytes(pad, 0, padLen);
-		TransformBytes(checksum, 0, 16);
+		TransformBytes(&pad[0], padLen);
+		TransformBytes(&checksum[0], 16);
 
 	} // end function Finish
 
@@ -81,8 +106,16 @@ protected:
 		return state;
 	} // end function GetResult
 		
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		register int32_t LBlockSize = buffer.GetLength();
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			MD2::TransformBlock(a_data + i * LBlockSize, LBlockSize, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
 	{
 		register uint32_t t = 0;
 
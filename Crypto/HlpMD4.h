@@ -27,16 +27,25 @@ public:
 	{
 		name = __func__;
 
-		data.resize(16);
+		data.fill(0);
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const MD4 &LSource = GetStateSource<MD4>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		MD4 HashInstance;
 
 		HashInstance = MD4();
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<MD4>(HashInstance);
@@ -46,8 +55,16 @@ public:
 	}
 
 protected:
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		register int32_t LBlockSize = buffer.GetLength();
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			MD4::TransformBlock(a_data + i * LBlockSize, LBlockSize, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
 	{
 		register uint32_t a, b, c, d;
 
@@ -167,7 +184,7 @@ protected:
 
 
 private:
-	HashLibUInt32Array data;
+	array<uint32_t, 16> data;
 
 }; // end class MD4
 
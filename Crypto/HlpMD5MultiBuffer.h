@@ -0,0 +1,180 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPMD5MULTIBUFFER_H
+#define HLPMD5MULTIBUFFER_H
+
+#include "../Base/HlpMultiBuffer.h"
+#include "../Base/HlpHashKernel.h"
+#include "../Utils/HlpLaneVectors.h"
+#include "HlpMD5.h"
+
+
+#ifdef HASHLIB_X86
+// Defines "a_name", the MD5 block function over the lanes of "V", for
+// the same reason and in the same way as HASHLIB_SHA2_256_LANE_KERNEL.
+#define HASHLIB_MD5_LANE_KERNEL(a_name, V, a_target) \
+	/* a = b + ((a + f + x + t) <<< s) */ \
+	HASHLIB_TARGET(a_target) \
+	static inline void a_name##Step(V::Vector &a, const V::Vector b, const V::Vector a_f, \
+		const V::Vector a_x, const int32_t t, const int32_t a_s) \
+	{ \
+		a = V::Add(b, V::RotateLeft(V::Add(V::Add(a, a_f), V::Add(a_x, V::Set1(T[t]))), a_s)); \
+	} \
+	\
+	HASHLIB_TARGET(a_target) \
+	static void a_name(uint32_t *a_state, const uint8_t *const *a_blocks, const size_t a_count) \
+	{ \
+		alignas(64) uint32_t LWords[16 * V::LANES]; \
+		V::Vector a, b, c, d, LX[16]; \
+		register int32_t t; \
+		\
+		for (register size_t i = 0; i < a_count; i++) \
+		{ \
+			MultiBuffer::GatherWords(LWords, a_blocks, V::LANES, i, false); \
+			\
+			for (t = 0; t < 16; t++) \
+				LX[t] = V::Load(&LWords[t * V::LANES]); \
+			\
+			a = V::Load(&a_state[0 * V::LANES]); \
+			b = V::Load(&a_state[1 * V::LANES]); \
+			c = V::Load(&a_state[2 * V::LANES]); \
+			d = V::Load(&a_state[3 * V::LANES]); \
+			\
+			for (t = 0; t < 16; t += 4) \
+			{ \
+				a_name##Step(a, b, V::Choose(b, c, d), LX[t], t, 7); \
+				a_name##Step(d, a, V::Choose(a, b, c), LX[t + 1], t + 1, 12); \
+				a_name##Step(c, d, V::Choose(d, a, b), LX[t + 2], t + 2, 17); \
+				a_name##Step(b, c, V::Choose(c, d, a), LX[t + 3], t + 3, 22); \
+			} \
+			\
+			for (t = 16; t < 32; t += 4) \
+			{ \
+				a_name##Step(a, b, V::Choose(d, b, c), LX[(5 * t + 1) & 15], t, 5); \
+				a_name##Step(d, a, V::Choose(c, a, b), LX[(5 * t + 6) & 15], t + 1, 9); \
+				a_name##Step(c, d, V::Choose(b, d, a), LX[(5 * t + 11) & 15], t + 2, 14); \
+				a_name##Step(b, c, V::Choose(a, c, d), LX[(5 * t + 16) & 15], t + 3, 20); \
+			} \
+			\
+			for (t = 32; t < 48; t += 4) \
+			{ \
+				a_name##Step(a, b, V::Xor3(b, c, d), LX[(3 * t + 5) & 15], t, 4); \
+				a_name##Step(d, a, V::Xor3(a, b, c), LX[(3 * t + 8) & 15], t + 1, 11); \
+				a_name##Step(c, d, V::Xor3(d, a, b), LX[(3 * t + 11) & 15], t + 2, 16); \
+				a_name##Step(b, c, V::Xor3(c, d, a), LX[(3 * t + 14) & 15], t + 3, 23); \
+			} \
+			\
+			for (t = 48; t < 64; t += 4) \
+			{ \
+				a_name##Step(a, b, V::XorOrNot(b, c, d), LX[(7 * t) & 15], t, 6); \
+				a_name##Step(d, a, V::XorOrNot(a, b, c), LX[(7 * t + 7) & 15], t + 1, 10); \
+				a_name##Step(c, d, V::XorOrNot(d, a, b), LX[(7 * t + 14) & 15], t + 2, 15); \
+				a_name##Step(b, c, V::XorOrNot(c, d, a), LX[(7 * t + 21) & 15], t + 3, 21); \
+			} \
+			\
+			V::Store(&a_state[0 * V::LANES], V::Add(V::Load(&a_state[0 * V::LANES]), a)); \
+			V::Store(&a_state[1 * V::LANES], V::Add(V::Load(&a_state[1 * V::LANES]), b)); \
+			V::Store(&a_state[2 * V::LANES], V::Add(V::Load(&a_state[2 * V::LANES]), c)); \
+			V::Store(&a_state[3 * V::LANES], V::Add(V::Load(&a_state[3 * V::LANES]), d)); \
+		} \
+	}
+#endif
+
+
+/// <summary>
+/// Computes MD5 digests of many independent messages at once, 8 (AVX2)
+/// or 16 (AVX-512) messages per pass. MD5 is one long dependency chain,
+/// so a single message cannot fill the core; independent messages side by
+/// side can.
+/// </summary>
+class MD5MultiBuffer
+{
+public:
+	static const KernelTable<LaneKernel> & GetKernels()
+	{
+		static const KernelTable<LaneKernel> LKernels({
+#ifdef HASHLIB_X86
+			{ "AVX-512", CpuAVX512, { 16, &MD5MultiBuffer::CompressAVX512 } },
+			{ "AVX2", CpuAVX2, { 8, &MD5MultiBuffer::CompressAVX2 } },
+#endif
+			{ "Serial", 0, { 1, nullptr } }
+		});
+
+		return LKernels;
+	} // end function GetKernels
+
+	static string GetKernelName()
+	{
+		return GetKernels().Select()->name;
+	} // end function GetKernelName
+
+	/// <summary>
+	/// Writes the digest of a_messages[i] to a_digests + i * 16.
+	/// </summary>
+	/// <exception cref="ArgumentHashLibException">A message has a negative length or no data.</exception>
+	static void ComputeInto(const HashLibSpan *a_messages, const size_t a_count, uint8_t *a_digests)
+	{
+		const LaneKernel &LKernel = GetKernels().Select()->function;
+
+		MultiBuffer::ValidateMessages(a_messages, a_count);
+
+		if (LKernel.compress == nullptr)
+		{
+			MD5 LMD5;
+
+			MultiBuffer::RunSerial(LMD5, a_messages, a_count, a_digests);
+			return;
+		} // end if
+
+		MultiBuffer::Algorithm LAlgorithm = { InitialState, 4, 16, false };
+		MultiBuffer::Run(LAlgorithm, LKernel, a_messages, a_count, a_digests);
+	} // end function ComputeInto
+
+	static HashLibHashResultArray Compute(const HashLibSpanArray &a_messages)
+	{
+		HashLibByteArray LDigests = HashLibByteArray(a_messages.size() * 16);
+
+		if (!a_messages.empty())
+			ComputeInto(&a_messages[0], a_messages.size(), &LDigests[0]);
+
+		return MultiBuffer::ToResults(LDigests, a_messages.size(), 16);
+	} // end function Compute
+
+private:
+#ifdef HASHLIB_X86
+	HASHLIB_MD5_LANE_KERNEL(CompressAVX2, LaneVectorAVX2, "avx2")
+	HASHLIB_MD5_LANE_KERNEL(CompressAVX512, LaneVectorAVX512, "avx512f")
+#endif
+
+	static const uint32_t InitialState[4];
+	static const uint32_t T[64];
+
+}; // end class MD5MultiBuffer
+
+const uint32_t MD5MultiBuffer::InitialState[4] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476 };
+
+const uint32_t MD5MultiBuffer::T[64] = {
+	0xD76AA478, 0xE8C7B756, 0x242070DB, 0xC1BDCEEE, 0xF57C0FAF, 0x4787C62A, 0xA8304613, 0xFD469501,
+	0x698098D8, 0x8B44F7AF, 0xFFFF5BB1, 0x895CD7BE, 0x6B901122, 0xFD987193, 0xA679438E, 0x49B40821,
+	0xF61E2562, 0xC040B340, 0x265E5A51, 0xE9B6C7AA, 0xD62F105D, 0x02441453, 0xD8A1E681, 0xE7D3FBC8,
+	0x21E1CDE6, 0xC33707D6, 0xF4D50D87, 0x455A14ED, 0xA9E3E905, 0xFCEFA3F8, 0x676F02D9, 0x8D2A4C8A,
+	0xFFFA3942, 0x8771F681, 0x6D9D6122, 0xFDE5380C, 0xA4BEEA44, 0x4BDECFA9, 0xF6BB4B60, 0xBEBFBC70,
+	0x289B7EC6, 0xEAA127FA, 0xD4EF3085, 0x04881D05, 0xD9D4D039, 0xE6DB99E5, 0x1FA27CF8, 0xC4AC5665,
+	0xF4292244, 0x432AFF97, 0xAB9423A7, 0xFC93A039, 0x655B59C3, 0x8F0CCC92, 0xFFEFF47D, 0x85845DD1,
+	0x6FA87E4F, 0xFE2CE6E0, 0xA3014314, 0x4E0811A1, 0xF7537E82, 0xBD3AF235, 0x2AD7D2BB, 0xEB86D391 };
+
+
+#endif // !HLPMD5MULTIBUFFER_H
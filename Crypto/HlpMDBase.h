@@ -37,7 +37,7 @@ protected:
 	MDBase(const int32_t a_state_length, const int32_t a_hash_size)
 		: BlockHash(a_hash_size, 64), size(a_state_length)
 	{
-		state.resize(size);		
+		state.fill(0);		
 	} // end constructor
 
 	~MDBase()
@@ -54,18 +54,50 @@ protected:
 		return result;
 	} // end function GetResult
 
+	virtual void GetResultInto(uint8_t *a_output)
+	{
+		Converters::le32_copy((uint32_t*)(&state[0]), 0, a_output, 0, size * sizeof(uint32_t));
+	} // end function GetResultInto
+
+	virtual bool TransformOneShot(const uint8_t *a_data, const int32_t a_length)
+	{
+		uint8_t LBlocks[ONE_SHOT_BLOCKS * 64];
+		register int32_t LCount;
+
+		LCount = PadMessage(a_data, a_length, LBlocks, 64, 8, false);
+		if (LCount == 0)
+			return false;
+
+		TransformBlocks(LBlocks, size_t(LCount));
+
+		return true;
+	} // end function TransformOneShot
+
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(state);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(state);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
 		uint64_t bits;
 		int32_t padindex;
 
 		bits = processed_bytes * 8;
-		if (buffer->GetPos() < 56)
-			padindex = 56 - buffer->GetPos();
+		if (buffer.GetPos() < 56)
+			padindex = 56 - buffer.GetPos();
 		else
-			padindex = 120 - buffer->GetPos();
+			padindex = 120 - buffer.GetPos();
 
-		HashLibByteArray pad = HashLibByteArray(padindex + 8);
+		uint8_t pad[128];
+		memset(pad, 0, (padindex + 8) * sizeof(uint8_t));
 
 		pad[0] = 0x80;
 
@@ -75,7 +107,7 @@ protected:
 
 		padindex = padindex + 8;
 
-		TransformBytes(pad, 0, padindex);
+		TransformBytes(&pad[0], padindex);
 
 	} // end function Finish
 	
@@ -89,7 +121,8 @@ protected:
 	static const uint32_t C7 = 0x7A6D76E9;
 	static const uint32_t C8 = 0xA953FD4E;
 	
-	HashLibUInt32Array state;
+	// large enough for RIPEMD320, the widest of the family
+	array<uint32_t, 10> state;
 	uint32_t size = 0;
 
 }; // end class MDBase
@@ -40,6 +40,20 @@ public:
 
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Panama &LSource = GetStateSource<Panama>(a_source);
+
+		state = LSource.state;
+		theta = LSource.theta;
+		gamma = LSource.gamma;
+		pi = LSource.pi;
+		stages = LSource.stages;
+		tap = LSource.tap;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		Panama HashInstance;
@@ -53,7 +67,7 @@ public:
 		HashInstance.stages = stages;
 
 		HashInstance.tap = tap;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<Panama>(HashInstance);
@@ -73,16 +87,34 @@ public:
 	} // end function Initialize
 
 protected:
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(state);
+		a_writer.Write(stages);
+		a_writer.Write(tap);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(state);
+		a_reader.Read(stages);
+		a_reader.Read(tap);
+		a_reader.Check(tap >= 0 && tap < 32);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
 		int32_t tap4, tap16, tap25;
 
 		int32_t padding_size = 32 - (processed_bytes & 31);
 
-		HashLibByteArray pad = HashLibByteArray(padding_size);
+		uint8_t pad[32];
+		memset(pad, 0, padding_size * sizeof(uint8_t));
 
 		pad[0] = 0x01;
-		TransformBytes(pad, 0, padding_size);
+		TransformBytes(&pad[0], padding_size);
 
 		HashLibUInt32Array theta = HashLibUInt32Array(17);
 
@@ -146,8 +178,16 @@ protected:
 		return result;
 	} // end function GetResult
 
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		register int32_t LBlockSize = buffer.GetLength();
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			Panama::TransformBlock(a_data + i * LBlockSize, LBlockSize, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
 	{
 		register uint32_t tap16, tap25;
 		
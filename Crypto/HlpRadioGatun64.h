@@ -38,6 +38,16 @@ public:
 
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const RadioGatun64 &LSource = GetStateSource<RadioGatun64>(a_source);
+
+		mill = LSource.mill;
+		belt = LSource.belt;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		RadioGatun64 HashInstance;
@@ -45,7 +55,7 @@ public:
 		HashInstance = RadioGatun64();
 		HashInstance.mill = mill;
 		HashInstance.belt = belt;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<RadioGatun64>(HashInstance);
@@ -65,15 +75,30 @@ public:
 	} // end function Initialize
 
 protected:
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(mill);
+		a_writer.Write(belt);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(mill);
+		a_reader.Read(belt);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
 		int32_t padding_size = 24 - (processed_bytes % 24);
 
-		HashLibByteArray pad = HashLibByteArray(padding_size);
+		uint8_t pad[24];
+		memset(pad, 0, padding_size * sizeof(uint8_t));
 
 		pad[0] = 0x01;
 
-		TransformBytes(pad, 0, padding_size);
+		TransformBytes(&pad[0], padding_size);
 
 		for (register uint32_t i = 0; i < 16; i++)
 			RoundFunction();
@@ -97,8 +122,16 @@ protected:
 		return result;
 	} // end function GetResult
 
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		register int32_t LBlockSize = buffer.GetLength();
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			RadioGatun64::TransformBlock(a_data + i * LBlockSize, LBlockSize, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
 	{
 		Converters::le64_copy(a_data, a_index, &data[0], 0, 24);
 
@@ -27,17 +27,26 @@ public:
 	{
 		name = __func__;
 
-		state.resize(5);
-		data.resize(80);
+		state.fill(0);
+		data.fill(0);
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const SHA0 &LSource = GetStateSource<SHA0>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		SHA0 HashInstance;
 
 		HashInstance = SHA0();
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<SHA0>(HashInstance);
@@ -127,17 +136,44 @@ protected:
 
 	} // end function Expand
 		
+	virtual bool TransformOneShot(const uint8_t *a_data, const int32_t a_length)
+	{
+		uint8_t LBlocks[ONE_SHOT_BLOCKS * 64];
+		register int32_t LCount;
+
+		LCount = PadMessage(a_data, a_length, LBlocks, 64, 8, true);
+		if (LCount == 0)
+			return false;
+
+		TransformBlocks(LBlocks, size_t(LCount));
+
+		return true;
+	} // end function TransformOneShot
+
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(state);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(state);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
 		int32_t padindex;
 		
 		uint64_t bits = processed_bytes * 8;
-		if (buffer->GetPos() < 56)
-			padindex = 56 - buffer->GetPos();
+		if (buffer.GetPos() < 56)
+			padindex = 56 - buffer.GetPos();
 		else
-			padindex = 120 - buffer->GetPos();
+			padindex = 120 - buffer.GetPos();
 
-		HashLibByteArray pad = HashLibByteArray(padindex + 8);
+		uint8_t pad[128];
+		memset(pad, 0, (padindex + 8) * sizeof(uint8_t));
 
 		pad[0] = 0x80;
 
@@ -147,7 +183,7 @@ protected:
 
 		padindex = padindex + 8;
 
-		TransformBytes(pad, 0, padindex);
+		TransformBytes(&pad[0], padindex);
 
 	} // end function Finish
 	
@@ -158,9 +194,22 @@ protected:
 
 		return result;
 	} // end function GetResult
+
+	virtual void GetResultInto(uint8_t *a_output)
+	{
+		Converters::be32_copy(&state[0], 0, a_output, 0, 5 * sizeof(uint32_t));
+	} // end function GetResultInto
 		
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		register int32_t LBlockSize = buffer.GetLength();
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			SHA0::TransformBlock(a_data + i * LBlockSize, LBlockSize, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
 	{
 		uint32_t A, B, C, D, E;
 
@@ -466,8 +515,8 @@ protected:
 
 
 protected:
-	HashLibUInt32Array state;
-	HashLibUInt32Array data;
+	array<uint32_t, 5> state;
+	array<uint32_t, 80> data;
 
 	static const uint32_t C1 = 0x5A827999;
 	static const uint32_t C2 = 0x6ED9EBA1;
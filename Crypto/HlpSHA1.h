@@ -17,24 +17,55 @@
 #define HLPSHA1_H
 
 #include "HlpSHA0.h"
+#include "HlpSHAExtensions.h"
+#include "../Base/HlpHashKernel.h"
 
 
 class SHA1 : public SHA0
 {
 public:
+	// Compresses a_blocks consecutive 64 byte blocks into a_state.
+	typedef void (*CompressFunction)(uint32_t *a_state, const uint8_t *a_data, const size_t a_blocks);
+
 	SHA1()
-		: SHA0()
+		: SHA0(), kernel(GetKernels().Select())
 	{
 		name = __func__;
 	} // end constructor
 
+	static const KernelTable<CompressFunction> & GetKernels()
+	{
+		static const KernelTable<CompressFunction> LKernels({
+#ifdef HASHLIB_X86
+			{ "SHA-NI", CpuSHA | CpuSSSE3 | CpuSSE41, &SHAExtensions::CompressSHA1 },
+#endif
+			{ "Portable", 0, nullptr }
+		});
+
+		return LKernels;
+	} // end function GetKernels
+
+	virtual string GetKernelName() const
+	{
+		return kernel->name;
+	} // end function GetKernelName
+
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const SHA1 &LSource = GetStateSource<SHA1>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		SHA1 HashInstance;
 
 		HashInstance = SHA1();
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<SHA1>(HashInstance);
@@ -44,6 +75,23 @@ public:
 	}
 
 protected:
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		if (kernel->function != nullptr)
+			kernel->function(&state[0], a_data, a_blocks);
+		else
+			SHA0::TransformBlocks(a_data, a_blocks);
+	} // end function TransformBlocks
+
+	virtual void TransformBlock(const uint8_t *a_data,
+		const int32_t a_data_length, const int32_t a_index)
+	{
+		if (kernel->function != nullptr)
+			kernel->function(&state[0], a_data + a_index, 1);
+		else
+			SHA0::TransformBlock(a_data, a_data_length, a_index);
+	} // end function TransformBlock
+
 	virtual void Expand(uint32_t *a_data)
 	{
 		register uint32_t T;
@@ -180,6 +228,9 @@ protected:
 	} // end function Expand
 
 
+private:
+	const HashKernel<CompressFunction> *kernel;
+
 }; // end class SHA1
 
 
@@ -0,0 +1,192 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPSHA1MULTIBUFFER_H
+#define HLPSHA1MULTIBUFFER_H
+
+#include "../Base/HlpMultiBuffer.h"
+#include "../Base/HlpHashKernel.h"
+#include "../Utils/HlpLaneVectors.h"
+#include "HlpSHA1.h"
+
+
+#ifdef HASHLIB_X86
+// Defines "a_name", the SHA-1 block function over the lanes of "V", for
+// the same reason and in the same way as HASHLIB_SHA2_256_LANE_KERNEL.
+#define HASHLIB_SHA1_LANE_KERNEL(a_name, V, a_target) \
+	/* e += (a <<< 5) + f + W[t] + K; b <<<= 30 */ \
+	HASHLIB_TARGET(a_target) \
+	static inline void a_name##Step(const V::Vector a, V::Vector &b, V::Vector &e, \
+		const V::Vector a_f, const V::Vector a_wk) \
+	{ \
+		e = V::Add(V::Add(e, V::RotateLeft(a, 5)), V::Add(a_f, a_wk)); \
+		b = V::RotateLeft(b, 30); \
+	} \
+	\
+	/* W[t] + a_k, expanding W in place from t = 16 on */ \
+	HASHLIB_TARGET(a_target) \
+	static inline V::Vector a_name##Word(V::Vector *a_w, const int32_t t, const V::Vector a_k) \
+	{ \
+		if (t >= 16) \
+			a_w[t & 15] = V::RotateLeft(V::Xor(V::Xor3(a_w[(t - 3) & 15], a_w[(t - 8) & 15], \
+				a_w[(t - 14) & 15]), a_w[t & 15]), 1); \
+		\
+		return V::Add(a_w[t & 15], a_k); \
+	} \
+	\
+	HASHLIB_TARGET(a_target) \
+	static void a_name(uint32_t *a_state, const uint8_t *const *a_blocks, const size_t a_count) \
+	{ \
+		alignas(64) uint32_t LWords[16 * V::LANES]; \
+		V::Vector a, b, c, d, e, LK, LW[16]; \
+		register int32_t t; \
+		\
+		for (register size_t i = 0; i < a_count; i++) \
+		{ \
+			MultiBuffer::GatherWords(LWords, a_blocks, V::LANES, i, true); \
+			\
+			for (t = 0; t < 16; t++) \
+				LW[t] = V::Load(&LWords[t * V::LANES]); \
+			\
+			a = V::Load(&a_state[0 * V::LANES]); \
+			b = V::Load(&a_state[1 * V::LANES]); \
+			c = V::Load(&a_state[2 * V::LANES]); \
+			d = V::Load(&a_state[3 * V::LANES]); \
+			e = V::Load(&a_state[4 * V::LANES]); \
+			\
+			LK = V::Set1(0x5A827999); \
+			for (t = 0; t < 20; t += 5) \
+			{ \
+				a_name##Step(a, b, e, V::Choose(b, c, d), a_name##Word(LW, t, LK)); \
+				a_name##Step(e, a, d, V::Choose(a, b, c), a_name##Word(LW, t + 1, LK)); \
+				a_name##Step(d, e, c, V::Choose(e, a, b), a_name##Word(LW, t + 2, LK)); \
+				a_name##Step(c, d, b, V::Choose(d, e, a), a_name##Word(LW, t + 3, LK)); \
+				a_name##Step(b, c, a, V::Choose(c, d, e), a_name##Word(LW, t + 4, LK)); \
+			} \
+			\
+			LK = V::Set1(0x6ED9EBA1); \
+			for (t = 20; t < 40; t += 5) \
+			{ \
+				a_name##Step(a, b, e, V::Xor3(b, c, d), a_name##Word(LW, t, LK)); \
+				a_name##Step(e, a, d, V::Xor3(a, b, c), a_name##Word(LW, t + 1, LK)); \
+				a_name##Step(d, e, c, V::Xor3(e, a, b), a_name##Word(LW, t + 2, LK)); \
+				a_name##Step(c, d, b, V::Xor3(d, e, a), a_name##Word(LW, t + 3, LK)); \
+				a_name##Step(b, c, a, V::Xor3(c, d, e), a_name##Word(LW, t + 4, LK)); \
+			} \
+			\
+			LK = V::Set1(0x8F1BBCDC); \
+			for (t = 40; t < 60; t += 5) \
+			{ \
+				a_name##Step(a, b, e, V::Majority(b, c, d), a_name##Word(LW, t, LK)); \
+				a_name##Step(e, a, d, V::Majority(a, b, c), a_name##Word(LW, t + 1, LK)); \
+				a_name##Step(d, e, c, V::Majority(e, a, b), a_name##Word(LW, t + 2, LK)); \
+				a_name##Step(c, d, b, V::Majority(d, e, a), a_name##Word(LW, t + 3, LK)); \
+				a_name##Step(b, c, a, V::Majority(c, d, e), a_name##Word(LW, t + 4, LK)); \
+			} \
+			\
+			LK = V::Set1(0xCA62C1D6); \
+			for (t = 60; t < 80; t += 5) \
+			{ \
+				a_name##Step(a, b, e, V::Xor3(b, c, d), a_name##Word(LW, t, LK)); \
+				a_name##Step(e, a, d, V::Xor3(a, b, c), a_name##Word(LW, t + 1, LK)); \
+				a_name##Step(d, e, c, V::Xor3(e, a, b), a_name##Word(LW, t + 2, LK)); \
+				a_name##Step(c, d, b, V::Xor3(d, e, a), a_name##Word(LW, t + 3, LK)); \
+				a_name##Step(b, c, a, V::Xor3(c, d, e), a_name##Word(LW, t + 4, LK)); \
+			} \
+			\
+			V::Store(&a_state[0 * V::LANES], V::Add(V::Load(&a_state[0 * V::LANES]), a)); \
+			V::Store(&a_state[1 * V::LANES], V::Add(V::Load(&a_state[1 * V::LANES]), b)); \
+			V::Store(&a_state[2 * V::LANES], V::Add(V::Load(&a_state[2 * V::LANES]), c)); \
+			V::Store(&a_state[3 * V::LANES], V::Add(V::Load(&a_state[3 * V::LANES]), d)); \
+			V::Store(&a_state[4 * V::LANES], V::Add(V::Load(&a_state[4 * V::LANES]), e)); \
+		} \
+	}
+#endif
+
+
+/// <summary>
+/// Computes SHA-1 digests of many independent messages at once, 8 (AVX2)
+/// or 16 (AVX-512) messages per pass. As for SHA-256, hosts with SHA-NI
+/// hash the messages one at a time instead.
+/// </summary>
+class SHA1MultiBuffer
+{
+public:
+	static const KernelTable<LaneKernel> & GetKernels()
+	{
+		static const KernelTable<LaneKernel> LKernels({
+#ifdef HASHLIB_X86
+			{ "SHA-NI", CpuSHA | CpuSSSE3 | CpuSSE41, { 1, nullptr } },
+			{ "AVX-512", CpuAVX512, { 16, &SHA1MultiBuffer::CompressAVX512 } },
+			{ "AVX2", CpuAVX2, { 8, &SHA1MultiBuffer::CompressAVX2 } },
+#endif
+			{ "Serial", 0, { 1, nullptr } }
+		});
+
+		return LKernels;
+	} // end function GetKernels
+
+	static string GetKernelName()
+	{
+		return GetKernels().Select()->name;
+	} // end function GetKernelName
+
+	/// <summary>
+	/// Writes the digest of a_messages[i] to a_digests + i * 20.
+	/// </summary>
+	/// <exception cref="ArgumentHashLibException">A message has a negative length or no data.</exception>
+	static void ComputeInto(const HashLibSpan *a_messages, const size_t a_count, uint8_t *a_digests)
+	{
+		const LaneKernel &LKernel = GetKernels().Select()->function;
+
+		MultiBuffer::ValidateMessages(a_messages, a_count);
+
+		if (LKernel.compress == nullptr)
+		{
+			SHA1 LSHA1;
+
+			MultiBuffer::RunSerial(LSHA1, a_messages, a_count, a_digests);
+			return;
+		} // end if
+
+		MultiBuffer::Algorithm LAlgorithm = { InitialState, 5, 20, true };
+		MultiBuffer::Run(LAlgorithm, LKernel, a_messages, a_count, a_digests);
+	} // end function ComputeInto
+
+	static HashLibHashResultArray Compute(const HashLibSpanArray &a_messages)
+	{
+		HashLibByteArray LDigests = HashLibByteArray(a_messages.size() * 20);
+
+		if (!a_messages.empty())
+			ComputeInto(&a_messages[0], a_messages.size(), &LDigests[0]);
+
+		return MultiBuffer::ToResults(LDigests, a_messages.size(), 20);
+	} // end function Compute
+
+private:
+#ifdef HASHLIB_X86
+	HASHLIB_SHA1_LANE_KERNEL(CompressAVX2, LaneVectorAVX2, "avx2")
+	HASHLIB_SHA1_LANE_KERNEL(CompressAVX512, LaneVectorAVX512, "avx512f")
+#endif
+
+	static const uint32_t InitialState[5];
+
+}; // end class SHA1MultiBuffer
+
+const uint32_t SHA1MultiBuffer::InitialState[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE,
+	0x10325476, 0xC3D2E1F0 };
+
+
+#endif // !HLPSHA1MULTIBUFFER_H
@@ -0,0 +1,304 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPSHA2AVX2_H
+#define HLPSHA2AVX2_H
+
+#include "../Utils/HlpCpuFeatures.h"
+#include "../Utils/HlpBits.h"
+
+#ifdef HASHLIB_X86
+	#include <immintrin.h>
+
+
+/// <summary>
+/// SHA-256 and SHA-512 block functions for CPUs with AVX2 but without a
+/// SHA-512 instruction (or SHA-NI, for SHA-256). The message schedule
+/// is expanded four words at a time in YMM registers and stored with the
+/// round constants already added, so the scalar rounds only read one
+/// word per round. SHA-256 expands two blocks at once, one per 128-bit
+/// lane. Only registered where "CpuAVX2" and "CpuBMI2" are enabled, the
+/// latter for "rorx" in the rounds.
+/// </summary>
+class SHA2AVX2
+{
+public:
+	HASHLIB_TARGET("avx2,bmi2")
+	static void CompressSHA256(uint32_t *a_state, const uint8_t *a_data, const size_t a_blocks)
+	{
+		alignas(32) uint32_t LSchedule[2][64];
+		__m256i LW0, LW1, LW2, LW3, LSum;
+		const uint8_t *LNext;
+		const __m256i LMask = _mm256_set_epi64x(0x0C0D0E0F08090A0BULL, 0x0405060700010203ULL,
+			0x0C0D0E0F08090A0BULL, 0x0405060700010203ULL);
+
+		for (register size_t i = 0; i < a_blocks; i += 2, a_data += 128)
+		{
+			// with an odd count the last block fills both lanes
+			LNext = (i + 1 < a_blocks) ? a_data + 64 : a_data;
+
+			LW0 = Load256(a_data, LNext, 0, LMask);
+			LW1 = Load256(a_data, LNext, 16, LMask);
+			LW2 = Load256(a_data, LNext, 32, LMask);
+			LW3 = Load256(a_data, LNext, 48, LMask);
+
+			for (register int32_t t = 0; t < 64; t += 4)
+			{
+				LSum = _mm256_add_epi32(LW0,
+					_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)&K256[t])));
+				_mm_store_si128((__m128i *)&LSchedule[0][t], _mm256_castsi256_si128(LSum));
+				_mm_store_si128((__m128i *)&LSchedule[1][t], _mm256_extracti128_si256(LSum, 1));
+
+				// the last four groups need no further words
+				if (t < 48)
+					LSum = Expand256(LW0, LW1, LW2, LW3);
+				LW0 = LW1;
+				LW1 = LW2;
+				LW2 = LW3;
+				LW3 = LSum;
+			} // end for
+
+			Rounds256(a_state, LSchedule[0]);
+			if (LNext != a_data)
+				Rounds256(a_state, LSchedule[1]);
+		} // end for
+	} // end function CompressSHA256
+
+	HASHLIB_TARGET("avx2,bmi2")
+	static void CompressSHA512(uint64_t *a_state, const uint8_t *a_data, const size_t a_blocks)
+	{
+		alignas(32) uint64_t LSchedule[80];
+		__m256i LW0, LW1, LW2, LW3, LSum;
+		const __m256i LMask = _mm256_set_epi64x(0x08090A0B0C0D0E0FULL, 0x0001020304050607ULL,
+			0x08090A0B0C0D0E0FULL, 0x0001020304050607ULL);
+
+		for (register size_t i = 0; i < a_blocks; i++, a_data += 128)
+		{
+			LW0 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(a_data + 0)), LMask);
+			LW1 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(a_data + 32)), LMask);
+			LW2 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(a_data + 64)), LMask);
+			LW3 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(a_data + 96)), LMask);
+
+			for (register int32_t t = 0; t < 80; t += 4)
+			{
+				LSum = _mm256_add_epi64(LW0, _mm256_loadu_si256((const __m256i *)&K512[t]));
+				_mm256_store_si256((__m256i *)&LSchedule[t], LSum);
+
+				// the last four groups need no further words
+				if (t < 64)
+					LSum = Expand512(LW0, LW1, LW2, LW3);
+				LW0 = LW1;
+				LW1 = LW2;
+				LW2 = LW3;
+				LW3 = LSum;
+			} // end for
+
+			Rounds512(a_state, LSchedule);
+		} // end for
+	} // end function CompressSHA512
+
+	// round constants, also used by the multi-buffer SHA-256 kernels
+	static const uint32_t K256[64];
+	static const uint64_t K512[80];
+
+private:
+	HASHLIB_TARGET("avx2")
+	static inline __m256i Load256(const uint8_t *a_first, const uint8_t *a_second,
+		const int32_t a_offset, const __m256i a_mask)
+	{
+		return _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(
+			_mm_loadu_si128((const __m128i *)(a_first + a_offset))),
+			_mm_loadu_si128((const __m128i *)(a_second + a_offset)), 1), a_mask);
+	} // end function Load256
+
+	HASHLIB_TARGET("avx2")
+	static inline __m256i RotateRight32(const __m256i a_value, const int32_t a_n)
+	{
+		return _mm256_or_si256(_mm256_srli_epi32(a_value, a_n), _mm256_slli_epi32(a_value, 32 - a_n));
+	} // end function RotateRight32
+
+	HASHLIB_TARGET("avx2")
+	static inline __m256i RotateRight64(const __m256i a_value, const int32_t a_n)
+	{
+		return _mm256_or_si256(_mm256_srli_epi64(a_value, a_n), _mm256_slli_epi64(a_value, 64 - a_n));
+	} // end function RotateRight64
+
+	HASHLIB_TARGET("avx2")
+	static inline __m256i Sigma1_256(const __m256i a_value)
+	{
+		return _mm256_xor_si256(_mm256_xor_si256(RotateRight32(a_value, 17),
+			RotateRight32(a_value, 19)), _mm256_srli_epi32(a_value, 10));
+	} // end function Sigma1_256
+
+	// W[t..t+3] of both lanes from W[t-16..t-1] in a_w0..a_w3
+	HASHLIB_TARGET("avx2")
+	static inline __m256i Expand256(const __m256i a_w0, const __m256i a_w1,
+		const __m256i a_w2, const __m256i a_w3)
+	{
+		__m256i LW15, LResult;
+
+		LW15 = _mm256_alignr_epi8(a_w1, a_w0, 4);
+		LResult = _mm256_add_epi32(_mm256_add_epi32(a_w0, _mm256_alignr_epi8(a_w3, a_w2, 4)),
+			_mm256_xor_si256(_mm256_xor_si256(RotateRight32(LW15, 7), RotateRight32(LW15, 18)),
+				_mm256_srli_epi32(LW15, 3)));
+
+		// W[t] and W[t+1] depend on W[t-2] and W[t-1], the other two on them
+		LResult = _mm256_add_epi32(LResult, Sigma1_256(_mm256_srli_si256(a_w3, 8)));
+		return _mm256_add_epi32(LResult, Sigma1_256(_mm256_slli_si256(LResult, 8)));
+	} // end function Expand256
+
+	HASHLIB_TARGET("avx2")
+	static inline __m256i Sigma1_512(const __m256i a_value)
+	{
+		return _mm256_xor_si256(_mm256_xor_si256(RotateRight64(a_value, 19),
+			RotateRight64(a_value, 61)), _mm256_srli_epi64(a_value, 6));
+	} // end function Sigma1_512
+
+	// {a_low[1], a_low[2], a_low[3], a_high[0]}
+	HASHLIB_TARGET("avx2")
+	static inline __m256i Shift512(const __m256i a_high, const __m256i a_low)
+	{
+		return _mm256_alignr_epi8(_mm256_permute2x128_si256(a_low, a_high, 0x21), a_low, 8);
+	} // end function Shift512
+
+	HASHLIB_TARGET("avx2")
+	static inline __m256i Expand512(const __m256i a_w0, const __m256i a_w1,
+		const __m256i a_w2, const __m256i a_w3)
+	{
+		__m256i LW15, LResult;
+
+		LW15 = Shift512(a_w1, a_w0);
+		LResult = _mm256_add_epi64(_mm256_add_epi64(a_w0, Shift512(a_w3, a_w2)),
+			_mm256_xor_si256(_mm256_xor_si256(RotateRight64(LW15, 1), RotateRight64(LW15, 8)),
+				_mm256_srli_epi64(LW15, 7)));
+
+		LResult = _mm256_add_epi64(LResult, Sigma1_512(_mm256_permute2x128_si256(a_w3, a_w3, 0x81)));
+		return _mm256_add_epi64(LResult, Sigma1_512(_mm256_permute2x128_si256(LResult, LResult, 0x08)));
+	} // end function Expand512
+
+	static inline void Round256(const uint32_t a, const uint32_t b, const uint32_t c, uint32_t &d,
+		const uint32_t e, const uint32_t f, const uint32_t g, uint32_t &h, const uint32_t a_wk)
+	{
+		h = h + a_wk + (Bits::RotateRight32(e, 6) ^ Bits::RotateRight32(e, 11)
+			^ Bits::RotateRight32(e, 25)) + ((e & f) ^ (~e & g));
+		d = d + h;
+		h = h + (Bits::RotateRight32(a, 2) ^ Bits::RotateRight32(a, 13)
+			^ Bits::RotateRight32(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+	} // end function Round256
+
+	static inline void Round512(const uint64_t a, const uint64_t b, const uint64_t c, uint64_t &d,
+		const uint64_t e, const uint64_t f, const uint64_t g, uint64_t &h, const uint64_t a_wk)
+	{
+		h = h + a_wk + (Bits::RotateRight64(e, 14) ^ Bits::RotateRight64(e, 18)
+			^ Bits::RotateRight64(e, 41)) + ((e & f) ^ (~e & g));
+		d = d + h;
+		h = h + (Bits::RotateRight64(a, 28) ^ Bits::RotateRight64(a, 34)
+			^ Bits::RotateRight64(a, 39)) + ((a & b) ^ (a & c) ^ (b & c));
+	} // end function Round512
+
+	HASHLIB_TARGET("bmi2")
+	static inline void Rounds256(uint32_t *a_state, const uint32_t *a_schedule)
+	{
+		uint32_t a = a_state[0], b = a_state[1], c = a_state[2], d = a_state[3],
+			e = a_state[4], f = a_state[5], g = a_state[6], h = a_state[7];
+
+		for (register int32_t t = 0; t < 64; t += 8)
+		{
+			Round256(a, b, c, d, e, f, g, h, a_schedule[t + 0]);
+			Round256(h, a, b, c, d, e, f, g, a_schedule[t + 1]);
+			Round256(g, h, a, b, c, d, e, f, a_schedule[t + 2]);
+			Round256(f, g, h, a, b, c, d, e, a_schedule[t + 3]);
+			Round256(e, f, g, h, a, b, c, d, a_schedule[t + 4]);
+			Round256(d, e, f, g, h, a, b, c, a_schedule[t + 5]);
+			Round256(c, d, e, f, g, h, a, b, a_schedule[t + 6]);
+			Round256(b, c, d, e, f, g, h, a, a_schedule[t + 7]);
+		} // end for
+
+		a_state[0] = a_state[0] + a;
+		a_state[1] = a_state[1] + b;
+		a_state[2] = a_state[2] + c;
+		a_state[3] = a_state[3] + d;
+		a_state[4] = a_state[4] + e;
+		a_state[5] = a_state[5] + f;
+		a_state[6] = a_state[6] + g;
+		a_state[7] = a_state[7] + h;
+	} // end function Rounds256
+
+	HASHLIB_TARGET("bmi2")
+	static inline void Rounds512(uint64_t *a_state, const uint64_t *a_schedule)
+	{
+		uint64_t a = a_state[0], b = a_state[1], c = a_state[2], d = a_state[3],
+			e = a_state[4], f = a_state[5], g = a_state[6], h = a_state[7];
+
+		for (register int32_t t = 0; t < 80; t += 8)
+		{
+			Round512(a, b, c, d, e, f, g, h, a_schedule[t + 0]);
+			Round512(h, a, b, c, d, e, f, g, a_schedule[t + 1]);
+			Round512(g, h, a, b, c, d, e, f, a_schedule[t + 2]);
+			Round512(f, g, h, a, b, c, d, e, a_schedule[t + 3]);
+			Round512(e, f, g, h, a, b, c, d, a_schedule[t + 4]);
+			Round512(d, e, f, g, h, a, b, c, a_schedule[t + 5]);
+			Round512(c, d, e, f, g, h, a, b, a_schedule[t + 6]);
+			Round512(b, c, d, e, f, g, h, a, a_schedule[t + 7]);
+		} // end for
+
+		a_state[0] = a_state[0] + a;
+		a_state[1] = a_state[1] + b;
+		a_state[2] = a_state[2] + c;
+		a_state[3] = a_state[3] + d;
+		a_state[4] = a_state[4] + e;
+		a_state[5] = a_state[5] + f;
+		a_state[6] = a_state[6] + g;
+		a_state[7] = a_state[7] + h;
+	} // end function Rounds512
+
+}; // end class SHA2AVX2
+
+const uint32_t SHA2AVX2::K256[64] = {
+	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+	0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+	0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+	0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+	0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+	0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+	0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+	0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2 };
+
+const uint64_t SHA2AVX2::K512[80] = {
+	0x428A2F98D728AE22ULL, 0x7137449123EF65CDULL, 0xB5C0FBCFEC4D3B2FULL, 0xE9B5DBA58189DBBCULL,
+	0x3956C25BF348B538ULL, 0x59F111F1B605D019ULL, 0x923F82A4AF194F9BULL, 0xAB1C5ED5DA6D8118ULL,
+	0xD807AA98A3030242ULL, 0x12835B0145706FBEULL, 0x243185BE4EE4B28CULL, 0x550C7DC3D5FFB4E2ULL,
+	0x72BE5D74F27B896FULL, 0x80DEB1FE3B1696B1ULL, 0x9BDC06A725C71235ULL, 0xC19BF174CF692694ULL,
+	0xE49B69C19EF14AD2ULL, 0xEFBE4786384F25E3ULL, 0x0FC19DC68B8CD5B5ULL, 0x240CA1CC77AC9C65ULL,
+	0x2DE92C6F592B0275ULL, 0x4A7484AA6EA6E483ULL, 0x5CB0A9DCBD41FBD4ULL, 0x76F988DA831153B5ULL,
+	0x983E5152EE66DFABULL, 0xA831C66D2DB43210ULL, 0xB00327C898FB213FULL, 0xBF597FC7BEEF0EE4ULL,
+	0xC6E00BF33DA88FC2ULL, 0xD5A79147930AA725ULL, 0x06CA6351E003826FULL, 0x142929670A0E6E70ULL,
+	0x27B70A8546D22FFCULL, 0x2E1B21385C26C926ULL, 0x4D2C6DFC5AC42AEDULL, 0x53380D139D95B3DFULL,
+	0x650A73548BAF63DEULL, 0x766A0ABB3C77B2A8ULL, 0x81C2C92E47EDAEE6ULL, 0x92722C851482353BULL,
+	0xA2BFE8A14CF10364ULL, 0xA81A664BBC423001ULL, 0xC24B8B70D0F89791ULL, 0xC76C51A30654BE30ULL,
+	0xD192E819D6EF5218ULL, 0xD69906245565A910ULL, 0xF40E35855771202AULL, 0x106AA07032BBD1B8ULL,
+	0x19A4C116B8D2D0C8ULL, 0x1E376C085141AB53ULL, 0x2748774CDF8EEB99ULL, 0x34B0BCB5E19B48A8ULL,
+	0x391C0CB3C5C95A63ULL, 0x4ED8AA4AE3418ACBULL, 0x5B9CCA4F7763E373ULL, 0x682E6FF3D6B2B8A3ULL,
+	0x748F82EE5DEFB2FCULL, 0x78A5636F43172F60ULL, 0x84C87814A1F0AB72ULL, 0x8CC702081A6439ECULL,
+	0x90BEFFFA23631E28ULL, 0xA4506CEBDE82BDE9ULL, 0xBEF9A3F7B2C67915ULL, 0xC67178F2E372532BULL,
+	0xCA273ECEEA26619CULL, 0xD186B8C721C0C207ULL, 0xEADA7DD6CDE0EB1EULL, 0xF57D4F7FEE6ED178ULL,
+	0x06F067AA72176FBAULL, 0x0A637DC5A2C898A6ULL, 0x113F9804BEF90DAEULL, 0x1B710B35131C471BULL,
+	0x28DB77F523047D84ULL, 0x32CAAB7B40C72493ULL, 0x3C9EBE0A15C9BEBCULL, 0x431D67C49C100D4CULL,
+	0x4CC5D4BECB3E42B6ULL, 0x597F299CFC657E2AULL, 0x5FCB6FAB3AD6FAECULL, 0x6C44198C4A475817ULL };
+
+
+#endif // HASHLIB_X86
+
+#endif // !HLPSHA2AVX2_H
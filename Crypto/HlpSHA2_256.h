@@ -28,13 +28,22 @@ public:
 		name = __func__;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const SHA2_256 &LSource = GetStateSource<SHA2_256>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		SHA2_256 HashInstance;
 
 		HashInstance = SHA2_256();
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<SHA2_256>(HashInstance);
@@ -65,6 +74,11 @@ protected:
 
 		return result;
 	} // end function GetResult
+
+	virtual void GetResultInto(uint8_t *a_output)
+	{
+		Converters::be32_copy(&state[0], 0, a_output, 0, 8 * sizeof(uint32_t));
+	} // end function GetResultInto
 	
 }; // end class SHA2_256
 
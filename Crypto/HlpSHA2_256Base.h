@@ -17,29 +17,81 @@
 #define HLPSHA2_256BASE_H
 
 #include "../Base/HlpHashCryptoNotBuildIn.h"
+#include "../Base/HlpHashKernel.h"
+#include "HlpSHAExtensions.h"
+#include "HlpSHA2AVX2.h"
 
 
 class SHA2_256Base : public BlockHash, public IICryptoNotBuildIn, public IITransformBlock
 {
+public:
+	// Compresses a_blocks consecutive 64 byte blocks into a_state.
+	typedef void (*CompressFunction)(uint32_t *a_state, const uint8_t *a_data, const size_t a_blocks);
+
+	static const KernelTable<CompressFunction> & GetKernels()
+	{
+		static const KernelTable<CompressFunction> LKernels({
+#ifdef HASHLIB_X86
+			{ "SHA-NI", CpuSHA | CpuSSSE3 | CpuSSE41, &SHAExtensions::CompressSHA256 },
+			{ "AVX2", CpuAVX2 | CpuBMI2, &SHA2AVX2::CompressSHA256 },
+#endif
+			{ "Portable", 0, nullptr }
+		});
+
+		return LKernels;
+	} // end function GetKernels
+
+	virtual string GetKernelName() const
+	{
+		return kernel->name;
+	} // end function GetKernelName
+
 protected:
 	SHA2_256Base(const int32_t a_hash_size)
-		: BlockHash(a_hash_size, 64)
+		: BlockHash(a_hash_size, 64), kernel(GetKernels().Select())
 	{
-		state.resize(8);
-		data.resize(64);
+		state.fill(0);
+		data.fill(0);
 	} // end constructor
 
+	virtual bool TransformOneShot(const uint8_t *a_data, const int32_t a_length)
+	{
+		uint8_t LBlocks[ONE_SHOT_BLOCKS * 64];
+		register int32_t LCount;
+
+		LCount = PadMessage(a_data, a_length, LBlocks, 64, 8, true);
+		if (LCount == 0)
+			return false;
+
+		TransformBlocks(LBlocks, size_t(LCount));
+
+		return true;
+	} // end function TransformOneShot
+
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(state);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(state);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
 		int32_t padindex;
 
 		uint64_t bits = processed_bytes * 8;
-		if (buffer->GetPos() < 56)
-			padindex = 56 - buffer->GetPos();
+		if (buffer.GetPos() < 56)
+			padindex = 56 - buffer.GetPos();
 		else
-			padindex = 120 - buffer->GetPos();
+			padindex = 120 - buffer.GetPos();
 
-		HashLibByteArray pad = HashLibByteArray(padindex + 8);
+		uint8_t pad[128];
+		memset(pad, 0, (padindex + 8) * sizeof(uint8_t));
 
 		pad[0] = 0x80;
 
@@ -49,12 +101,29 @@ protected:
 
 		padindex = padindex + 8;
 
-		TransformBytes(pad, 0, padindex);
+		TransformBytes(&pad[0], padindex);
 
 	} // end function Finish
 
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		if (kernel->function != nullptr)
+		{
+			kernel->function(&state[0], a_data, a_blocks);
+			return;
+		} // end if
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			TransformBlockPortable(a_data + i * 64, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
+	{
+		SHA2_256Base::TransformBlocks(a_data + a_index, 1);
+	} // end function TransformBlock
+
+	inline void TransformBlockPortable(const uint8_t *a_data, const int32_t a_index)
 	{
 		register uint32_t A, B, C, D, E, F, G, H, T, T2;
 	
@@ -866,14 +935,12 @@ protected:
 		state[5]  = state[5] + F;
 		state[6]  = state[6] + G;
 		state[7]  = state[7] + H;
-
-		memset(&data[0], 0, sizeof(data));
-
-	} // end function TransformBlock
+	} // end function TransformBlockPortable
 
 protected:
-	HashLibUInt32Array state;
-	HashLibUInt32Array data;
+	array<uint32_t, 8> state;
+	array<uint32_t, 64> data;
+	const HashKernel<CompressFunction> *kernel;
 	
 }; // end class SHA2_256Base
 
@@ -0,0 +1,211 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPSHA2_256MULTIBUFFER_H
+#define HLPSHA2_256MULTIBUFFER_H
+
+#include "../Base/HlpMultiBuffer.h"
+#include "../Base/HlpHashKernel.h"
+#include "../Utils/HlpLaneVectors.h"
+#include "HlpSHA2_224.h"
+#include "HlpSHA2_256.h"
+
+
+#ifdef HASHLIB_X86
+// Defines "a_name", the SHA-256 block function over the lanes of "V", with
+// its round and message schedule helpers. GCC and Clang attach a target
+// to a whole function and never per template argument, and vectors must
+// not cross between functions of different targets, so every instruction
+// set gets its own copy of the code.
+#define HASHLIB_SHA2_256_LANE_KERNEL(a_name, V, a_target) \
+	HASHLIB_TARGET(a_target) \
+	static inline void a_name##Round(const V::Vector a, const V::Vector b, const V::Vector c, \
+		V::Vector &d, const V::Vector e, const V::Vector f, const V::Vector g, V::Vector &h, \
+		const V::Vector a_wk) \
+	{ \
+		h = V::Add(V::Add(h, a_wk), V::Add(V::Xor3(V::RotateRight(e, 6), V::RotateRight(e, 11), \
+			V::RotateRight(e, 25)), V::Choose(e, f, g))); \
+		d = V::Add(d, h); \
+		h = V::Add(h, V::Add(V::Xor3(V::RotateRight(a, 2), V::RotateRight(a, 13), \
+			V::RotateRight(a, 22)), V::Majority(a, b, c))); \
+	} \
+	\
+	/* W[t] + K[t], expanding W in place from t = 16 on */ \
+	HASHLIB_TARGET(a_target) \
+	static inline V::Vector a_name##Word(V::Vector *a_w, const int32_t t) \
+	{ \
+		V::Vector LW15, LW2; \
+		\
+		if (t >= 16) \
+		{ \
+			LW15 = a_w[(t - 15) & 15]; \
+			LW2 = a_w[(t - 2) & 15]; \
+			a_w[t & 15] = V::Add(V::Add(a_w[t & 15], a_w[(t - 7) & 15]), V::Add( \
+				V::Xor3(V::RotateRight(LW15, 7), V::RotateRight(LW15, 18), V::ShiftRight(LW15, 3)), \
+				V::Xor3(V::RotateRight(LW2, 17), V::RotateRight(LW2, 19), V::ShiftRight(LW2, 10)))); \
+		} \
+		\
+		return V::Add(a_w[t & 15], V::Set1(SHA2AVX2::K256[t])); \
+	} \
+	\
+	HASHLIB_TARGET(a_target) \
+	static void a_name(uint32_t *a_state, const uint8_t *const *a_blocks, const size_t a_count) \
+	{ \
+		alignas(64) uint32_t LWords[16 * V::LANES]; \
+		V::Vector a, b, c, d, e, f, g, h, LW[16]; \
+		\
+		for (register size_t i = 0; i < a_count; i++) \
+		{ \
+			MultiBuffer::GatherWords(LWords, a_blocks, V::LANES, i, true); \
+			for (register size_t t = 0; t < 16; t++) \
+				LW[t] = V::Load(&LWords[t * V::LANES]); \
+			\
+			a = V::Load(&a_state[0 * V::LANES]); \
+			b = V::Load(&a_state[1 * V::LANES]); \
+			c = V::Load(&a_state[2 * V::LANES]); \
+			d = V::Load(&a_state[3 * V::LANES]); \
+			e = V::Load(&a_state[4 * V::LANES]); \
+			f = V::Load(&a_state[5 * V::LANES]); \
+			g = V::Load(&a_state[6 * V::LANES]); \
+			h = V::Load(&a_state[7 * V::LANES]); \
+			\
+			for (register int32_t t = 0; t < 64; t += 8) \
+			{ \
+				a_name##Round(a, b, c, d, e, f, g, h, a_name##Word(LW, t + 0)); \
+				a_name##Round(h, a, b, c, d, e, f, g, a_name##Word(LW, t + 1)); \
+				a_name##Round(g, h, a, b, c, d, e, f, a_name##Word(LW, t + 2)); \
+				a_name##Round(f, g, h, a, b, c, d, e, a_name##Word(LW, t + 3)); \
+				a_name##Round(e, f, g, h, a, b, c, d, a_name##Word(LW, t + 4)); \
+				a_name##Round(d, e, f, g, h, a, b, c, a_name##Word(LW, t + 5)); \
+				a_name##Round(c, d, e, f, g, h, a, b, a_name##Word(LW, t + 6)); \
+				a_name##Round(b, c, d, e, f, g, h, a, a_name##Word(LW, t + 7)); \
+			} \
+			\
+			V::Store(&a_state[0 * V::LANES], V::Add(V::Load(&a_state[0 * V::LANES]), a)); \
+			V::Store(&a_state[1 * V::LANES], V::Add(V::Load(&a_state[1 * V::LANES]), b)); \
+			V::Store(&a_state[2 * V::LANES], V::Add(V::Load(&a_state[2 * V::LANES]), c)); \
+			V::Store(&a_state[3 * V::LANES], V::Add(V::Load(&a_state[3 * V::LANES]), d)); \
+			V::Store(&a_state[4 * V::LANES], V::Add(V::Load(&a_state[4 * V::LANES]), e)); \
+			V::Store(&a_state[5 * V::LANES], V::Add(V::Load(&a_state[5 * V::LANES]), f)); \
+			V::Store(&a_state[6 * V::LANES], V::Add(V::Load(&a_state[6 * V::LANES]), g)); \
+			V::Store(&a_state[7 * V::LANES], V::Add(V::Load(&a_state[7 * V::LANES]), h)); \
+		} \
+	}
+#endif
+
+
+/// <summary>
+/// Computes SHA-224 or SHA-256 digests of many independent messages at
+/// once, running 4 (SSE4.1), 8 (AVX2) or 16 (AVX-512) messages in the
+/// lanes of one vector register. Lengths may differ freely; each lane is
+/// refilled as soon as its message is done. Hosts with SHA-NI hash the
+/// messages one at a time instead: it beats the vector kernels on short
+/// messages and does not lower the clock the way AVX-512 can.
+/// </summary>
+class SHA2_256MultiBuffer
+{
+public:
+	static const KernelTable<LaneKernel> & GetKernels()
+	{
+		static const KernelTable<LaneKernel> LKernels({
+#ifdef HASHLIB_X86
+			{ "SHA-NI", CpuSHA | CpuSSSE3 | CpuSSE41, { 1, nullptr } },
+			{ "AVX-512", CpuAVX512, { 16, &SHA2_256MultiBuffer::CompressAVX512 } },
+			{ "AVX2", CpuAVX2, { 8, &SHA2_256MultiBuffer::CompressAVX2 } },
+			{ "SSE4.1", CpuSSE41, { 4, &SHA2_256MultiBuffer::CompressSSE41 } },
+#endif
+			{ "Serial", 0, { 1, nullptr } }
+		});
+
+		return LKernels;
+	} // end function GetKernels
+
+	static string GetKernelName()
+	{
+		return GetKernels().Select()->name;
+	} // end function GetKernelName
+
+	/// <summary>
+	/// Writes the digest of a_messages[i] to a_digests + i * a_hash_size.
+	/// </summary>
+	/// <param name="a_hash_size">28 for SHA-224, 32 for SHA-256.</param>
+	/// <exception cref="ArgumentHashLibException">A bad hash size or message.</exception>
+	static void ComputeInto(const HashLibSpan *a_messages, const size_t a_count,
+		uint8_t *a_digests, const int32_t a_hash_size = 32)
+	{
+		const LaneKernel &LKernel = GetKernels().Select()->function;
+
+		ValidateHashSize(a_hash_size);
+		MultiBuffer::ValidateMessages(a_messages, a_count);
+
+		if (LKernel.compress == nullptr)
+		{
+			SHA2_224 LSHA224;
+			SHA2_256 LSHA256;
+
+			if (a_hash_size == 28)
+				MultiBuffer::RunSerial(LSHA224, a_messages, a_count, a_digests);
+			else
+				MultiBuffer::RunSerial(LSHA256, a_messages, a_count, a_digests);
+			return;
+		} // end if
+
+		MultiBuffer::Algorithm LAlgorithm = { (a_hash_size == 28) ? InitialState224 : InitialState256,
+			8, a_hash_size, true };
+		MultiBuffer::Run(LAlgorithm, LKernel, a_messages, a_count, a_digests);
+	} // end function ComputeInto
+
+	static HashLibHashResultArray Compute(const HashLibSpanArray &a_messages,
+		const int32_t a_hash_size = 32)
+	{
+		ValidateHashSize(a_hash_size);
+
+		HashLibByteArray LDigests = HashLibByteArray(a_messages.size() * a_hash_size);
+
+		if (!a_messages.empty())
+			ComputeInto(&a_messages[0], a_messages.size(), &LDigests[0], a_hash_size);
+
+		return MultiBuffer::ToResults(LDigests, a_messages.size(), a_hash_size);
+	} // end function Compute
+
+private:
+	static inline void ValidateHashSize(const int32_t a_hash_size)
+	{
+		if (a_hash_size != 28 && a_hash_size != 32)
+			throw ArgumentHashLibException(SHA2_256MultiBuffer::InvalidHashSize);
+	} // end function ValidateHashSize
+
+#ifdef HASHLIB_X86
+	HASHLIB_SHA2_256_LANE_KERNEL(CompressSSE41, LaneVectorSSE41, "sse4.1")
+	HASHLIB_SHA2_256_LANE_KERNEL(CompressAVX2, LaneVectorAVX2, "avx2")
+	HASHLIB_SHA2_256_LANE_KERNEL(CompressAVX512, LaneVectorAVX512, "avx512f")
+#endif
+
+	static const uint32_t InitialState224[8];
+	static const uint32_t InitialState256[8];
+
+	static const char *InvalidHashSize;
+
+}; // end class SHA2_256MultiBuffer
+
+const uint32_t SHA2_256MultiBuffer::InitialState224[8] = { 0xC1059ED8, 0x367CD507,
+	0x3070DD17, 0xF70E5939, 0xFFC00B31, 0x68581511, 0x64F98FA7, 0xBEFA4FA4 };
+const uint32_t SHA2_256MultiBuffer::InitialState256[8] = { 0x6A09E667, 0xBB67AE85,
+	0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19 };
+
+const char *SHA2_256MultiBuffer::InvalidHashSize = "Hash size must be 28 (SHA-224) or 32 (SHA-256)";
+
+
+#endif // !HLPSHA2_256MULTIBUFFER_H
@@ -17,18 +17,67 @@
 #define HLPSHA2_512BASE_H
 
 #include "../Base/HlpHashCryptoNotBuildIn.h"
+#include "../Base/HlpHashKernel.h"
+#include "HlpSHA2AVX2.h"
 
 
 class SHA2_512Base : public BlockHash, public IICryptoNotBuildIn, public IITransformBlock
 {
+public:
+	// Compresses a_blocks consecutive 128 byte blocks into a_state.
+	typedef void (*CompressFunction)(uint64_t *a_state, const uint8_t *a_data, const size_t a_blocks);
+
+	static const KernelTable<CompressFunction> & GetKernels()
+	{
+		static const KernelTable<CompressFunction> LKernels({
+#ifdef HASHLIB_X86
+			{ "AVX2", CpuAVX2 | CpuBMI2, &SHA2AVX2::CompressSHA512 },
+#endif
+			{ "Portable", 0, nullptr }
+		});
+
+		return LKernels;
+	} // end function GetKernels
+
+	virtual string GetKernelName() const
+	{
+		return kernel->name;
+	} // end function GetKernelName
+
 protected:
 	SHA2_512Base(const int32_t a_hash_size)
-		: BlockHash(a_hash_size, 128)
+		: BlockHash(a_hash_size, 128), kernel(GetKernels().Select())
 	{
-		state.resize(8);
-		data.resize(80);
+		state.fill(0);
+		data.fill(0);
 	} // end constructor
 
+	virtual bool TransformOneShot(const uint8_t *a_data, const int32_t a_length)
+	{
+		uint8_t LBlocks[ONE_SHOT_BLOCKS * 128];
+		register int32_t LCount;
+
+		LCount = PadMessage(a_data, a_length, LBlocks, 128, 16, true);
+		if (LCount == 0)
+			return false;
+
+		TransformBlocks(LBlocks, size_t(LCount));
+
+		return true;
+	} // end function TransformOneShot
+
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(state);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(state);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
 		register uint64_t lowBits, hiBits;
@@ -37,13 +86,14 @@ protected:
 		lowBits = processed_bytes << 3;
 		hiBits = processed_bytes >> 61;
 
-		if (buffer->GetPos() < 112)
-			padindex = 111 - buffer->GetPos();
+		if (buffer.GetPos() < 112)
+			padindex = 111 - buffer.GetPos();
 		else
-			padindex = 239 - buffer->GetPos();
+			padindex = 239 - buffer.GetPos();
 
 		padindex++;
-		HashLibByteArray pad = HashLibByteArray(padindex + 16);
+		uint8_t pad[256];
+		memset(pad, 0, (padindex + 16) * sizeof(uint8_t));
 
 		pad[0] = 0x80;
 
@@ -59,12 +109,29 @@ protected:
 
 		padindex = padindex + 8;
 
-		TransformBytes(pad, 0, padindex);
+		TransformBytes(&pad[0], padindex);
 
 	} // end function Finish
 
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		if (kernel->function != nullptr)
+		{
+			kernel->function(&state[0], a_data, a_blocks);
+			return;
+		} // end if
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			TransformBlockPortable(a_data + i * 128, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
+	{
+		SHA2_512Base::TransformBlocks(a_data + a_index, 1);
+	} // end function TransformBlock
+
+	inline void TransformBlockPortable(const uint8_t *a_data, const int32_t a_index)
 	{
 		register uint64_t T0, T1, a, b, c, d, e, f, g, h;
 		
@@ -1134,13 +1201,12 @@ protected:
 		state[5]  = state[5] + f;
 		state[6]  = state[6] + g;
 		state[7]  = state[7] + h;
-
-		memset(&data[0], 0, sizeof(data));
-	} // end function TransformBlock
+	} // end function TransformBlockPortable
 
 protected:
-	HashLibUInt64Array state;
-	HashLibUInt64Array data;
+	array<uint64_t, 8> state;
+	array<uint64_t, 80> data;
+	const HashKernel<CompressFunction> *kernel;
 
 }; // end class SHA2_512Base
 
@@ -28,13 +28,22 @@ public:
 		name = __func__;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const SHA2_512_256 &LSource = GetStateSource<SHA2_512_256>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		SHA2_512_256 HashInstance;
 
 		HashInstance = SHA2_512_256();
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<SHA2_512_256>(HashInstance);
@@ -66,6 +75,11 @@ protected:
 		return result;
 	} // end function GetResult
 
+	virtual void GetResultInto(uint8_t *a_output)
+	{
+		Converters::be64_copy(&state[0], 0, a_output, 0, 4 * sizeof(uint64_t));
+	} // end function GetResultInto
+
 }; // end class SHA2_512_256
 
 
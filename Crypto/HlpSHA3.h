@@ -52,7 +52,7 @@ protected:
 		HashSize = GetHashSize();
 		BlockSize = GetBlockSize();
 
-		state.resize(25);
+		state.fill(0);
 	} // end constructor
 	
 	virtual string GetName() const
@@ -70,24 +70,64 @@ protected:
 		}
 	}
 
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(state);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(state);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
-		int32_t buffer_pos = buffer->GetPos();
-		
-		HashLibByteArray block = buffer->GetBytesZeroPadded();
+		int32_t buffer_pos = buffer.GetPos();
+		uint8_t block[200];
+
+		memmove(block, buffer.GetBytesInPlace(), buffer_pos * sizeof(uint8_t));
+		memset(&block[buffer_pos], 0, (BlockSize - buffer_pos) * sizeof(uint8_t));
 
 		block[buffer_pos] = int32_t(hash_mode);
 		block[BlockSize - 1] = block[BlockSize - 1] ^ 0x80;
 
-		TransformBlock(&block[0], buffer->GetLength(), 0);
+		TransformBlock(block, BlockSize, 0);
+
+		ComplementLanes();
+
+	} // end function Finish
+
+	virtual bool TransformOneShot(const uint8_t *a_data, const int32_t a_length)
+	{
+		uint8_t block[200];
+
+		// the padding byte must land inside a single rate sized block
+		if (a_length >= BlockSize)
+			return false;
+
+		memmove(block, a_data, a_length * sizeof(uint8_t));
+		memset(&block[a_length], 0, (BlockSize - a_length) * sizeof(uint8_t));
 
+		block[a_length] = int32_t(hash_mode);
+		block[BlockSize - 1] = block[BlockSize - 1] ^ 0x80;
+
+		SHA3::TransformBlock(block, BlockSize, 0);
+
+		ComplementLanes();
+
+		return true;
+	} // end function TransformOneShot
+
+	inline void ComplementLanes()
+	{
 		state[1] = ~state[1];
 		state[2] = ~state[2];
 		state[8] = ~state[8];
 		state[12] = ~state[12];
 		state[17] = ~state[17];
-
-	} // end function Finish
+	} // end function ComplementLanes
 
 	virtual HashLibByteArray GetResult()
 	{
@@ -98,8 +138,21 @@ protected:
 		return result;
 	} // end function GetResult
 
+	virtual void GetResultInto(uint8_t *a_output)
+	{
+		Converters::le64_copy(&state[0], 0, a_output, 0, HashSize);
+	} // end function GetResultInto
+
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		register int32_t LBlockSize = buffer.GetLength();
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			SHA3::TransformBlock(a_data + i * LBlockSize, LBlockSize, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
 	{
 		uint64_t Aba, Abe, Abi, Abo, Abu, Aga, Age, Agi, Ago, Agu, Aka, Ake, Aki, Ako, Aku,
 			Ama, Ame, Ami, Amo, Amu, Asa, Ase, Asi, Aso, Asu, Bba, Bbe, Bbi, Bbo, Bbu,
@@ -2727,7 +2780,7 @@ protected:
 	} // end function TransformBlock
 
 protected:
-	HashLibUInt64Array state;
+	array<uint64_t, 25> state;
 	int32_t HashSize, BlockSize;
 	HashMode hash_mode;
 
@@ -2749,11 +2802,20 @@ public:
 		hash_mode = HashMode::hmSHA3;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const SHA3_224 &LSource = GetStateSource<SHA3_224>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		SHA3_224 HashInstance = SHA3_224();
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<SHA3_224>(HashInstance);
@@ -2774,11 +2836,20 @@ public:
 		hash_mode = HashMode::hmSHA3;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const SHA3_256 &LSource = GetStateSource<SHA3_256>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		SHA3_256 HashInstance = SHA3_256();
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<SHA3_256>(HashInstance);
@@ -2799,11 +2870,20 @@ public:
 		hash_mode = HashMode::hmSHA3;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const SHA3_384 &LSource = GetStateSource<SHA3_384>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		SHA3_384 HashInstance = SHA3_384();
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<SHA3_384>(HashInstance);
@@ -2824,11 +2904,20 @@ public:
 		hash_mode = HashMode::hmSHA3;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const SHA3_512 &LSource = GetStateSource<SHA3_512>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		SHA3_512 HashInstance = SHA3_512();
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<SHA3_512>(HashInstance);
@@ -2849,11 +2938,20 @@ public:
 		hash_mode = HashMode::hmKeccak;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Keccak_224 &LSource = GetStateSource<Keccak_224>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		Keccak_224 HashInstance = Keccak_224();
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<Keccak_224>(HashInstance);
@@ -2873,11 +2971,20 @@ public:
 		hash_mode = HashMode::hmKeccak;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Keccak_256 &LSource = GetStateSource<Keccak_256>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		Keccak_256 HashInstance = Keccak_256();
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<Keccak_256>(HashInstance);
@@ -2897,11 +3004,20 @@ public:
 		hash_mode = HashMode::hmKeccak;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Keccak_384 &LSource = GetStateSource<Keccak_384>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		Keccak_384 HashInstance = Keccak_384();
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<Keccak_384>(HashInstance);
@@ -2921,11 +3037,20 @@ public:
 		hash_mode = HashMode::hmKeccak;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Keccak_512 &LSource = GetStateSource<Keccak_512>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		Keccak_512 HashInstance = Keccak_512();
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<Keccak_512>(HashInstance);
@@ -0,0 +1,368 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPSHAEXTENSIONS_H
+#define HLPSHAEXTENSIONS_H
+
+#include "../Utils/HlpCpuFeatures.h"
+
+#ifdef HASHLIB_X86
+	#include <immintrin.h>
+
+
+/// <summary>
+/// SHA-1 and SHA-256 block functions on the x86 SHA extensions. The
+/// message schedule and two (SHA-256) or four (SHA-1) rounds per
+/// instruction run in SSE registers, so a block costs a fraction of the
+/// portable code. Only registered where "CpuSHA", "CpuSSSE3" and "CpuSSE41"
+/// are enabled. SHA-0 cannot use them, since "sha1msg2" applies the SHA-1
+/// rotation.
+/// </summary>
+class SHAExtensions
+{
+public:
+	HASHLIB_TARGET("sha,ssse3,sse4.1")
+	static void CompressSHA1(uint32_t *a_state, const uint8_t *a_data, const size_t a_blocks)
+	{
+		__m128i LABCD, LABCDSave, LE0, LE0Save, LE1;
+		__m128i LMsg0, LMsg1, LMsg2, LMsg3;
+		const __m128i LMask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090A0B0C0D0E0FULL);
+
+		LABCD = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)a_state), 0x1B);
+		LE0 = _mm_set_epi32(int32_t(a_state[4]), 0, 0, 0);
+
+		for (register size_t i = 0; i < a_blocks; i++, a_data += 64)
+		{
+			LABCDSave = LABCD;
+			LE0Save = LE0;
+
+			// Rounds 0-3
+			LMsg0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(a_data + 0)), LMask);
+			LE0 = _mm_add_epi32(LE0, LMsg0);
+			LE1 = LABCD;
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE0, 0);
+
+			// Rounds 4-7
+			LMsg1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(a_data + 16)), LMask);
+			LE1 = _mm_sha1nexte_epu32(LE1, LMsg1);
+			LE0 = LABCD;
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE1, 0);
+			LMsg0 = _mm_sha1msg1_epu32(LMsg0, LMsg1);
+
+			// Rounds 8-11
+			LMsg2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(a_data + 32)), LMask);
+			LE0 = _mm_sha1nexte_epu32(LE0, LMsg2);
+			LE1 = LABCD;
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE0, 0);
+			LMsg1 = _mm_sha1msg1_epu32(LMsg1, LMsg2);
+			LMsg0 = _mm_xor_si128(LMsg0, LMsg2);
+
+			// Rounds 12-15
+			LMsg3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(a_data + 48)), LMask);
+			LE1 = _mm_sha1nexte_epu32(LE1, LMsg3);
+			LE0 = LABCD;
+			LMsg0 = _mm_sha1msg2_epu32(LMsg0, LMsg3);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE1, 0);
+			LMsg2 = _mm_sha1msg1_epu32(LMsg2, LMsg3);
+			LMsg1 = _mm_xor_si128(LMsg1, LMsg3);
+
+			// Rounds 16-19
+			LE0 = _mm_sha1nexte_epu32(LE0, LMsg0);
+			LE1 = LABCD;
+			LMsg1 = _mm_sha1msg2_epu32(LMsg1, LMsg0);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE0, 0);
+			LMsg3 = _mm_sha1msg1_epu32(LMsg3, LMsg0);
+			LMsg2 = _mm_xor_si128(LMsg2, LMsg0);
+
+			// Rounds 20-23
+			LE1 = _mm_sha1nexte_epu32(LE1, LMsg1);
+			LE0 = LABCD;
+			LMsg2 = _mm_sha1msg2_epu32(LMsg2, LMsg1);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE1, 1);
+			LMsg0 = _mm_sha1msg1_epu32(LMsg0, LMsg1);
+			LMsg3 = _mm_xor_si128(LMsg3, LMsg1);
+
+			// Rounds 24-27
+			LE0 = _mm_sha1nexte_epu32(LE0, LMsg2);
+			LE1 = LABCD;
+			LMsg3 = _mm_sha1msg2_epu32(LMsg3, LMsg2);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE0, 1);
+			LMsg1 = _mm_sha1msg1_epu32(LMsg1, LMsg2);
+			LMsg0 = _mm_xor_si128(LMsg0, LMsg2);
+
+			// Rounds 28-31
+			LE1 = _mm_sha1nexte_epu32(LE1, LMsg3);
+			LE0 = LABCD;
+			LMsg0 = _mm_sha1msg2_epu32(LMsg0, LMsg3);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE1, 1);
+			LMsg2 = _mm_sha1msg1_epu32(LMsg2, LMsg3);
+			LMsg1 = _mm_xor_si128(LMsg1, LMsg3);
+
+			// Rounds 32-35
+			LE0 = _mm_sha1nexte_epu32(LE0, LMsg0);
+			LE1 = LABCD;
+			LMsg1 = _mm_sha1msg2_epu32(LMsg1, LMsg0);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE0, 1);
+			LMsg3 = _mm_sha1msg1_epu32(LMsg3, LMsg0);
+			LMsg2 = _mm_xor_si128(LMsg2, LMsg0);
+
+			// Rounds 36-39
+			LE1 = _mm_sha1nexte_epu32(LE1, LMsg1);
+			LE0 = LABCD;
+			LMsg2 = _mm_sha1msg2_epu32(LMsg2, LMsg1);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE1, 1);
+			LMsg0 = _mm_sha1msg1_epu32(LMsg0, LMsg1);
+			LMsg3 = _mm_xor_si128(LMsg3, LMsg1);
+
+			// Rounds 40-43
+			LE0 = _mm_sha1nexte_epu32(LE0, LMsg2);
+			LE1 = LABCD;
+			LMsg3 = _mm_sha1msg2_epu32(LMsg3, LMsg2);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE0, 2);
+			LMsg1 = _mm_sha1msg1_epu32(LMsg1, LMsg2);
+			LMsg0 = _mm_xor_si128(LMsg0, LMsg2);
+
+			// Rounds 44-47
+			LE1 = _mm_sha1nexte_epu32(LE1, LMsg3);
+			LE0 = LABCD;
+			LMsg0 = _mm_sha1msg2_epu32(LMsg0, LMsg3);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE1, 2);
+			LMsg2 = _mm_sha1msg1_epu32(LMsg2, LMsg3);
+			LMsg1 = _mm_xor_si128(LMsg1, LMsg3);
+
+			// Rounds 48-51
+			LE0 = _mm_sha1nexte_epu32(LE0, LMsg0);
+			LE1 = LABCD;
+			LMsg1 = _mm_sha1msg2_epu32(LMsg1, LMsg0);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE0, 2);
+			LMsg3 = _mm_sha1msg1_epu32(LMsg3, LMsg0);
+			LMsg2 = _mm_xor_si128(LMsg2, LMsg0);
+
+			// Rounds 52-55
+			LE1 = _mm_sha1nexte_epu32(LE1, LMsg1);
+			LE0 = LABCD;
+			LMsg2 = _mm_sha1msg2_epu32(LMsg2, LMsg1);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE1, 2);
+			LMsg0 = _mm_sha1msg1_epu32(LMsg0, LMsg1);
+			LMsg3 = _mm_xor_si128(LMsg3, LMsg1);
+
+			// Rounds 56-59
+			LE0 = _mm_sha1nexte_epu32(LE0, LMsg2);
+			LE1 = LABCD;
+			LMsg3 = _mm_sha1msg2_epu32(LMsg3, LMsg2);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE0, 2);
+			LMsg1 = _mm_sha1msg1_epu32(LMsg1, LMsg2);
+			LMsg0 = _mm_xor_si128(LMsg0, LMsg2);
+
+			// Rounds 60-63
+			LE1 = _mm_sha1nexte_epu32(LE1, LMsg3);
+			LE0 = LABCD;
+			LMsg0 = _mm_sha1msg2_epu32(LMsg0, LMsg3);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE1, 3);
+			LMsg2 = _mm_sha1msg1_epu32(LMsg2, LMsg3);
+			LMsg1 = _mm_xor_si128(LMsg1, LMsg3);
+
+			// Rounds 64-67
+			LE0 = _mm_sha1nexte_epu32(LE0, LMsg0);
+			LE1 = LABCD;
+			LMsg1 = _mm_sha1msg2_epu32(LMsg1, LMsg0);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE0, 3);
+			LMsg3 = _mm_sha1msg1_epu32(LMsg3, LMsg0);
+			LMsg2 = _mm_xor_si128(LMsg2, LMsg0);
+
+			// Rounds 68-71
+			LE1 = _mm_sha1nexte_epu32(LE1, LMsg1);
+			LE0 = LABCD;
+			LMsg2 = _mm_sha1msg2_epu32(LMsg2, LMsg1);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE1, 3);
+			LMsg3 = _mm_xor_si128(LMsg3, LMsg1);
+
+			// Rounds 72-75
+			LE0 = _mm_sha1nexte_epu32(LE0, LMsg2);
+			LE1 = LABCD;
+			LMsg3 = _mm_sha1msg2_epu32(LMsg3, LMsg2);
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE0, 3);
+
+			// Rounds 76-79
+			LE1 = _mm_sha1nexte_epu32(LE1, LMsg3);
+			LE0 = LABCD;
+			LABCD = _mm_sha1rnds4_epu32(LABCD, LE1, 3);
+
+			LE0 = _mm_sha1nexte_epu32(LE0, LE0Save);
+			LABCD = _mm_add_epi32(LABCD, LABCDSave);
+		} // end for
+
+		_mm_storeu_si128((__m128i *)a_state, _mm_shuffle_epi32(LABCD, 0x1B));
+		a_state[4] = uint32_t(_mm_extract_epi32(LE0, 3));
+	} // end function CompressSHA1
+
+	HASHLIB_TARGET("sha,ssse3,sse4.1")
+	static void CompressSHA256(uint32_t *a_state, const uint8_t *a_data, const size_t a_blocks)
+	{
+		__m128i LState0, LState1, LABEFSave, LCDGHSave, LMsg, LTemp;
+		__m128i LMsg0, LMsg1, LMsg2, LMsg3;
+		const __m128i LMask = _mm_set_epi64x(0x0C0D0E0F08090A0BULL, 0x0405060700010203ULL);
+
+		// the rounds instruction wants the state as ABEF and CDGH
+		LTemp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&a_state[0]), 0xB1);
+		LState1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&a_state[4]), 0x1B);
+		LState0 = _mm_alignr_epi8(LTemp, LState1, 8);
+		LState1 = _mm_blend_epi16(LState1, LTemp, 0xF0);
+
+		for (register size_t i = 0; i < a_blocks; i++, a_data += 64)
+		{
+			LABEFSave = LState0;
+			LCDGHSave = LState1;
+
+			// Rounds 0-3
+			LMsg0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(a_data + 0)), LMask);
+			LMsg = _mm_add_epi32(LMsg0, _mm_set_epi64x(0xE9B5DBA5B5C0FBCFULL, 0x71374491428A2F98ULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+
+			// Rounds 4-7
+			LMsg1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(a_data + 16)), LMask);
+			LMsg = _mm_add_epi32(LMsg1, _mm_set_epi64x(0xAB1C5ED5923F82A4ULL, 0x59F111F13956C25BULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+			LMsg0 = _mm_sha256msg1_epu32(LMsg0, LMsg1);
+
+			// Rounds 8-11
+			LMsg2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(a_data + 32)), LMask);
+			LMsg = _mm_add_epi32(LMsg2, _mm_set_epi64x(0x550C7DC3243185BEULL, 0x12835B01D807AA98ULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+			LMsg1 = _mm_sha256msg1_epu32(LMsg1, LMsg2);
+
+			// Rounds 12-15
+			LMsg3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(a_data + 48)), LMask);
+			LMsg = _mm_add_epi32(LMsg3, _mm_set_epi64x(0xC19BF1749BDC06A7ULL, 0x80DEB1FE72BE5D74ULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg0 = _mm_sha256msg2_epu32(_mm_add_epi32(LMsg0, _mm_alignr_epi8(LMsg3, LMsg2, 4)), LMsg3);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+			LMsg2 = _mm_sha256msg1_epu32(LMsg2, LMsg3);
+
+			// Rounds 16-19
+			LMsg = _mm_add_epi32(LMsg0, _mm_set_epi64x(0x240CA1CC0FC19DC6ULL, 0xEFBE4786E49B69C1ULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg1 = _mm_sha256msg2_epu32(_mm_add_epi32(LMsg1, _mm_alignr_epi8(LMsg0, LMsg3, 4)), LMsg0);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+			LMsg3 = _mm_sha256msg1_epu32(LMsg3, LMsg0);
+
+			// Rounds 20-23
+			LMsg = _mm_add_epi32(LMsg1, _mm_set_epi64x(0x76F988DA5CB0A9DCULL, 0x4A7484AA2DE92C6FULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg2 = _mm_sha256msg2_epu32(_mm_add_epi32(LMsg2, _mm_alignr_epi8(LMsg1, LMsg0, 4)), LMsg1);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+			LMsg0 = _mm_sha256msg1_epu32(LMsg0, LMsg1);
+
+			// Rounds 24-27
+			LMsg = _mm_add_epi32(LMsg2, _mm_set_epi64x(0xBF597FC7B00327C8ULL, 0xA831C66D983E5152ULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg3 = _mm_sha256msg2_epu32(_mm_add_epi32(LMsg3, _mm_alignr_epi8(LMsg2, LMsg1, 4)), LMsg2);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+			LMsg1 = _mm_sha256msg1_epu32(LMsg1, LMsg2);
+
+			// Rounds 28-31
+			LMsg = _mm_add_epi32(LMsg3, _mm_set_epi64x(0x1429296706CA6351ULL, 0xD5A79147C6E00BF3ULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg0 = _mm_sha256msg2_epu32(_mm_add_epi32(LMsg0, _mm_alignr_epi8(LMsg3, LMsg2, 4)), LMsg3);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+			LMsg2 = _mm_sha256msg1_epu32(LMsg2, LMsg3);
+
+			// Rounds 32-35
+			LMsg = _mm_add_epi32(LMsg0, _mm_set_epi64x(0x53380D134D2C6DFCULL, 0x2E1B213827B70A85ULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg1 = _mm_sha256msg2_epu32(_mm_add_epi32(LMsg1, _mm_alignr_epi8(LMsg0, LMsg3, 4)), LMsg0);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+			LMsg3 = _mm_sha256msg1_epu32(LMsg3, LMsg0);
+
+			// Rounds 36-39
+			LMsg = _mm_add_epi32(LMsg1, _mm_set_epi64x(0x92722C8581C2C92EULL, 0x766A0ABB650A7354ULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg2 = _mm_sha256msg2_epu32(_mm_add_epi32(LMsg2, _mm_alignr_epi8(LMsg1, LMsg0, 4)), LMsg1);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+			LMsg0 = _mm_sha256msg1_epu32(LMsg0, LMsg1);
+
+			// Rounds 40-43
+			LMsg = _mm_add_epi32(LMsg2, _mm_set_epi64x(0xC76C51A3C24B8B70ULL, 0xA81A664BA2BFE8A1ULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg3 = _mm_sha256msg2_epu32(_mm_add_epi32(LMsg3, _mm_alignr_epi8(LMsg2, LMsg1, 4)), LMsg2);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+			LMsg1 = _mm_sha256msg1_epu32(LMsg1, LMsg2);
+
+			// Rounds 44-47
+			LMsg = _mm_add_epi32(LMsg3, _mm_set_epi64x(0x106AA070F40E3585ULL, 0xD6990624D192E819ULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg0 = _mm_sha256msg2_epu32(_mm_add_epi32(LMsg0, _mm_alignr_epi8(LMsg3, LMsg2, 4)), LMsg3);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+			LMsg2 = _mm_sha256msg1_epu32(LMsg2, LMsg3);
+
+			// Rounds 48-51
+			LMsg = _mm_add_epi32(LMsg0, _mm_set_epi64x(0x34B0BCB52748774CULL, 0x1E376C0819A4C116ULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg1 = _mm_sha256msg2_epu32(_mm_add_epi32(LMsg1, _mm_alignr_epi8(LMsg0, LMsg3, 4)), LMsg0);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+			LMsg3 = _mm_sha256msg1_epu32(LMsg3, LMsg0);
+
+			// Rounds 52-55
+			LMsg = _mm_add_epi32(LMsg1, _mm_set_epi64x(0x682E6FF35B9CCA4FULL, 0x4ED8AA4A391C0CB3ULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg2 = _mm_sha256msg2_epu32(_mm_add_epi32(LMsg2, _mm_alignr_epi8(LMsg1, LMsg0, 4)), LMsg1);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+
+			// Rounds 56-59
+			LMsg = _mm_add_epi32(LMsg2, _mm_set_epi64x(0x8CC7020884C87814ULL, 0x78A5636F748F82EEULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg3 = _mm_sha256msg2_epu32(_mm_add_epi32(LMsg3, _mm_alignr_epi8(LMsg2, LMsg1, 4)), LMsg2);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+
+			// Rounds 60-63
+			LMsg = _mm_add_epi32(LMsg3, _mm_set_epi64x(0xC67178F2BEF9A3F7ULL, 0xA4506CEB90BEFFFAULL));
+			LState1 = _mm_sha256rnds2_epu32(LState1, LState0, LMsg);
+			LMsg = _mm_shuffle_epi32(LMsg, 0x0E);
+			LState0 = _mm_sha256rnds2_epu32(LState0, LState1, LMsg);
+
+			LState0 = _mm_add_epi32(LState0, LABEFSave);
+			LState1 = _mm_add_epi32(LState1, LCDGHSave);
+		} // end for
+
+		LTemp = _mm_shuffle_epi32(LState0, 0x1B);
+		LState1 = _mm_shuffle_epi32(LState1, 0xB1);
+		_mm_storeu_si128((__m128i *)&a_state[0], _mm_blend_epi16(LTemp, LState1, 0xF0));
+		_mm_storeu_si128((__m128i *)&a_state[4], _mm_alignr_epi8(LState1, LTemp, 8));
+	} // end function CompressSHA256
+
+}; // end class SHAExtensions
+
+
+#endif // HASHLIB_X86
+
+#endif // !HLPSHAEXTENSIONS_H
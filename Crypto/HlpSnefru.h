@@ -36,11 +36,26 @@ public:
 		
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Snefru &LSource = GetStateSource<Snefru>(a_source);
+
+		state = LSource.state;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+		security_level = LSource.security_level;
+		HashSize = LSource.HashSize;
+		BlockSize = LSource.BlockSize;
+		size = LSource.size;
+		hash_size = LSource.hash_size;
+		block_size = LSource.block_size;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		Snefru HashInstance = Snefru(security_level, GetHashSize(hash_size));
 		HashInstance.state = state;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<Snefru>(HashInstance);
@@ -77,17 +92,30 @@ protected:
 		}
 	}
 
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(state);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(state);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
 		int32_t padindex;
 		
 		uint64_t bits = processed_bytes * 8;
-		if (buffer->GetPos() > 0)
-			padindex = 2 * BlockSize - buffer->GetPos() - 8;
+		if (buffer.GetPos() > 0)
+			padindex = 2 * BlockSize - buffer.GetPos() - 8;
 		else
-			padindex = BlockSize - buffer->GetPos() - 8;
+			padindex = BlockSize - buffer.GetPos() - 8;
 
-		HashLibByteArray pad = HashLibByteArray(padindex + 8);
+		uint8_t pad[128];
+		memset(pad, 0, (padindex + 8) * sizeof(uint8_t));
 
 		bits = Converters::be2me_64(bits);
 
@@ -95,7 +123,7 @@ protected:
 
 		padindex = padindex + 8;
 
-		TransformBytes(pad, 0, padindex);
+		TransformBytes(&pad[0], padindex);
 
 	} // end function Finish
 
@@ -108,8 +136,16 @@ protected:
 		return result;
 	} // end function GetResult
 
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		register int32_t LBlockSize = buffer.GetLength();
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			Snefru::TransformBlock(a_data + i * LBlockSize, LBlockSize, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
 	{
 		register uint32_t i, j, k, shift;
 		
@@ -24,11 +24,22 @@
 class Tiger : public BlockHash, public IICryptoNotBuildIn, public IITransformBlock
 {
 public:
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Tiger &LSource = GetStateSource<Tiger>(a_source);
+
+		hash = LSource.hash;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+		hash_size = LSource.hash_size;
+		rounds = LSource.rounds;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		Tiger HashInstance = Tiger(hash_size, GetHashRound(rounds));
 		HashInstance.hash = hash;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<Tiger>(HashInstance);
@@ -59,8 +70,8 @@ protected:
 		name = __func__;
 
 		rounds = int32_t(a_rounds);
-		hash.resize(3);
-		data.resize(8);
+		hash.fill(0);
+		data.fill(0);
 	} // end constructor
 
 	static inline HashRounds GetHashRound(const int32_t HashRound)
@@ -81,17 +92,30 @@ protected:
 		}
 	}
 
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(hash);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(hash);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
 		int32_t padindex;
 
 		uint64_t bits = processed_bytes * 8;
-		if (buffer->GetPos() < 56)
-			padindex = 56 - buffer->GetPos();
+		if (buffer.GetPos() < 56)
+			padindex = 56 - buffer.GetPos();
 		else
-			padindex = 120 - buffer->GetPos();
+			padindex = 120 - buffer.GetPos();
 		
-		HashLibByteArray pad = HashLibByteArray(padindex + 8);
+		uint8_t pad[128];
+		memset(pad, 0, (padindex + 8) * sizeof(uint8_t));
 
 		pad[0] = 1;
 
@@ -101,7 +125,7 @@ protected:
 
 		padindex = padindex + 8;
 
-		TransformBytes(pad, 0, padindex);
+		TransformBytes(&pad[0], padindex);
 
 	} // end function Finish
 
@@ -114,8 +138,16 @@ protected:
 		return result;
 	} // end function GetResult
 
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		register int32_t LBlockSize = buffer.GetLength();
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			Tiger::TransformBlock(a_data + i * LBlockSize, LBlockSize, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
 	{
 		register uint64_t a, b, c, temp_a;
 		register uint32_t _rounds;
@@ -424,8 +456,8 @@ public:
 	static const char *InvalidHashRound;
 
 private:
-	HashLibUInt64Array hash;
-	HashLibUInt64Array data;
+	array<uint64_t, 3> hash;
+	array<uint64_t, 8> data;
 	int32_t rounds;
 
 	static const uint64_t C1 = 0xA5A5A5A5A5A5A5A5;
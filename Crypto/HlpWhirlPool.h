@@ -27,20 +27,29 @@ public:
 	{
 		name = __func__;
 
-		hash.resize(8);
-		data.resize(8);
-		k.resize(8);
-		m.resize(8);
-		temp.resize(8);
+		hash.fill(0);
+		data.fill(0);
+		k.fill(0);
+		m.fill(0);
+		temp.fill(0);
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const WhirlPool &LSource = GetStateSource<WhirlPool>(a_source);
+
+		hash = LSource.hash;
+		buffer = LSource.buffer;
+		processed_bytes = LSource.processed_bytes;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		WhirlPool HashInstance;
 
 		HashInstance = WhirlPool();
 		HashInstance.hash = hash;
-		HashInstance.buffer = make_shared<HashBuffer>(buffer->Clone());
+		HashInstance.buffer = buffer;
 		HashInstance.processed_bytes = processed_bytes;
 
 		IHash hash = make_shared<WhirlPool>(HashInstance);
@@ -57,17 +66,30 @@ public:
 	} // end function Initialize
 
 protected:
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		BlockHash::WriteState(a_writer);
+		a_writer.Write(hash);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		BlockHash::ReadState(a_reader);
+		a_reader.Read(hash);
+	} // end function ReadState
+
 	virtual void Finish()
 	{
 		int32_t padindex;
 
 		uint64_t bits = processed_bytes * 8;
-		if (buffer->GetPos() > 31)
-			padindex = 120 - buffer->GetPos();
+		if (buffer.GetPos() > 31)
+			padindex = 120 - buffer.GetPos();
 		else
-			padindex = 56 - buffer->GetPos();
+			padindex = 56 - buffer.GetPos();
 
-		HashLibByteArray pad = HashLibByteArray(padindex + 8);
+		uint8_t pad[128];
+		memset(pad, 0, (padindex + 8) * sizeof(uint8_t));
 
 		pad[0] = 0x80;
 
@@ -77,7 +99,7 @@ protected:
 
 		padindex = padindex + 8;
 
-		TransformBytes(pad, 0, padindex);
+		TransformBytes(&pad[0], padindex);
 
 	} // end function Finish
 
@@ -90,8 +112,16 @@ protected:
 		return result;
 	} // end function GetResult
 
+	virtual void TransformBlocks(const uint8_t *a_data, const size_t a_blocks)
+	{
+		register int32_t LBlockSize = buffer.GetLength();
+
+		for (register size_t i = 0; i < a_blocks; i++)
+			WhirlPool::TransformBlock(a_data + i * LBlockSize, LBlockSize, 0);
+	} // end function TransformBlocks
+
 	virtual void TransformBlock(const uint8_t *a_data,
-		const int32_t a_data_length, const int32_t a_index)
+		const int32_t, const int32_t a_index)
 	{
 		Converters::be64_copy(a_data, a_index, &data[0], 0, 64);
 
@@ -211,9 +241,9 @@ private:
 	}
 
 private:
-	HashLibUInt64Array hash;
+	array<uint64_t, 8> hash;
 	
-	HashLibUInt64Array data, k, m, temp;
+	array<uint64_t, 8> data, k, m, temp;
 
 	static char initialized;
 	static HashLibUInt64Array C0, C1, C2, C3, C4, C5, C6, C7, rc;
@@ -42,6 +42,18 @@ public:
 		return hash;
 	}
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const MurmurHash3_x64_128 &LSource = GetStateSource<MurmurHash3_x64_128>(a_source);
+
+		h1 = LSource.h1;
+		h2 = LSource.h2;
+		total_length = LSource.total_length;
+		key = LSource.key;
+		idx = LSource.idx;
+		buf = LSource.buf;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		IHash hash = make_shared<MurmurHash3_x64_128>(Copy());
@@ -75,45 +87,54 @@ public:
 		return result;
 	} // end function TransformFinal
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformFinalInto(uint8_t *a_output, const size_t a_output_length)
+	{
+		ValidateOutputLength(a_output_length);
+
+		Finish();
+
+		Converters::ReadUInt64AsBytesBE(h1, a_output, 0);
+		Converters::ReadUInt64AsBytesBE(h2, a_output, 8);
+
+		Initialize();
+	} // end function TransformFinalInto
+
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
-		register int32_t len, nBlocks, i, offset, lIdx;
+		register int64_t index, len, nBlocks, i, offset, lIdx;
 		register uint64_t k1, k2;
 		const uint8_t *ptr_a_data = 0;
 
 		len = a_length;
-		i = a_index;
+		i = 0;
+		index = 0;
 		lIdx = 0;
-		total_length += len;
-		ptr_a_data = &a_data[0];
+		total_length += uint64_t(len);
+		ptr_a_data = a_data;
 
         //consume last pending bytes
 		if (idx && a_length)
 		{
-			//assert(a_index == 0); //nothing would work anyways if a_index is !=0
-
 			while (idx < 16 && len)
 			{
-				buf[idx++] = *(ptr_a_data + a_index);
-				a_index++;
+				buf[idx++] = *(ptr_a_data + index);
+				index++;
 				len--;
 			}
 
 			if (idx == 16)
 				ProcessPendings();
 		}
-		else
-			i = 0;
 
 		nBlocks = len >> 4;
 
         // body
 		while (i < nBlocks)
 		{
-			k1 = Converters::ReadBytesAsUInt64LE(ptr_a_data, a_index + lIdx);
+			k1 = Converters::ReadBytesAsUInt64LE(ptr_a_data, index + lIdx);
 			lIdx += 8;
 
-			k2 = Converters::ReadBytesAsUInt64LE(ptr_a_data, a_index +lIdx);
+			k2 = Converters::ReadBytesAsUInt64LE(ptr_a_data, index +lIdx);
 			lIdx += 8;
 
 			k1 = k1 * C1;
@@ -137,8 +158,8 @@ public:
 			i++;
 		} // end if
 
-		offset = a_index + (i * 16);
-		while (offset < (a_index + len))
+		offset = index + (i * 16);
+		while (offset < (index + len))
 		{
 			ByteUpdate(a_data[offset]);
 			offset++;
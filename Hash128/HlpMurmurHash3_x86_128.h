@@ -42,6 +42,20 @@ public:
 		return hash;
 	}
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const MurmurHash3_x86_128 &LSource = GetStateSource<MurmurHash3_x86_128>(a_source);
+
+		key = LSource.key;
+		h1 = LSource.h1;
+		h2 = LSource.h2;
+		h3 = LSource.h3;
+		h4 = LSource.h4;
+		total_length = LSource.total_length;
+		idx = LSource.idx;
+		buf = LSource.buf;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		IHash hash = make_shared<MurmurHash3_x86_128>(Copy());
@@ -77,48 +91,45 @@ public:
 		return result;
 	} // end function TransformFinal
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
-		register int32_t len, nBlocks, i, offset, lIdx;
+		register int64_t index, len, nBlocks, i, offset, lIdx;
 		register uint32_t k1, k2, k3, k4;
 		const uint8_t *ptr_a_data = 0;
 		
 		len = a_length;
-		i = a_index;
+		i = 0;
+		index = 0;
 		lIdx = 0;
-		total_length += len;
-		ptr_a_data = &a_data[0];
+		total_length += uint32_t(len);
+		ptr_a_data = a_data;
 
         //consume last pending bytes
         if (idx && len)
         {
-            //assert(a_index == 0); //nothing would work anyways if a_index is !=0
-
             while (idx < 16 && len)
             {
-                buf[idx++] = *(ptr_a_data + a_index);
-                a_index++;
+                buf[idx++] = *(ptr_a_data + index);
+                index++;
                 len--;
             }
             
             if (idx == 16)
                 ProcessPendings();
         }
-		else
-			i = 0;
 
 		nBlocks = len >> 4;
 
 		// body
 		while (i < nBlocks)
 		{
-			k1 = Converters::ReadBytesAsUInt32LE(ptr_a_data, a_index + lIdx);
+			k1 = Converters::ReadBytesAsUInt32LE(ptr_a_data, index + lIdx);
 			lIdx += 4;
-			k2 = Converters::ReadBytesAsUInt32LE(ptr_a_data, a_index + lIdx);
+			k2 = Converters::ReadBytesAsUInt32LE(ptr_a_data, index + lIdx);
 			lIdx += 4;
-			k3 = Converters::ReadBytesAsUInt32LE(ptr_a_data, a_index + lIdx);
+			k3 = Converters::ReadBytesAsUInt32LE(ptr_a_data, index + lIdx);
 			lIdx += 4;
-			k4 = Converters::ReadBytesAsUInt32LE(ptr_a_data, a_index + lIdx);
+			k4 = Converters::ReadBytesAsUInt32LE(ptr_a_data, index + lIdx);
 			lIdx += 4;
 
 			k1 = k1 * C1;
@@ -164,8 +175,8 @@ public:
 			i++;
 		} // end if
 
-		offset = a_index + (i * 16);
-		while (offset < (a_index + len))
+		offset = index + (i * 16);
+		while (offset < (index + len))
 		{
 			ByteUpdate(a_data[offset]);
 			offset++;
@@ -29,6 +29,14 @@ public:
 		name = __func__;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const AP &LSource = GetStateSource<AP>(a_source);
+
+		hash = LSource.hash;
+		index = LSource.index;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		AP HashInstance;
@@ -58,9 +66,9 @@ public:
 		return result;
 	} // end function TransformFinal
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
-		register uint32_t i = a_index;
+		register uint64_t i = 0;
 
 		while (a_length > 0)
 		{
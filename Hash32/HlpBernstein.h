@@ -29,6 +29,13 @@ public:
 		name = __func__;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Bernstein &LSource = GetStateSource<Bernstein>(a_source);
+
+		hash = LSource.hash;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		Bernstein HashInstance;
@@ -56,9 +63,9 @@ public:
 		return result;
 	} // end function TransformFinal
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
-		register uint32_t i = a_index;
+		register uint64_t i = 0;
 
 		while (a_length > 0)
 		{
@@ -28,6 +28,13 @@ public:
 		name = __func__;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const DEK &LSource = GetStateSource<DEK>(a_source);
+
+		_list = LSource._list;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		DEK HashInstance;
@@ -43,11 +50,11 @@ public:
 	}
 
 protected:
-	virtual IHashResult ComputeAggregatedBytes(const HashLibByteArray &a_data)
+	virtual IHashResult ComputeAggregatedBytes(const uint8_t *a_data, const int64_t a_length)
 	{
-		register uint32_t hash = uint32_t(a_data.size());
+		register uint32_t hash = uint32_t(a_length);
 
-		for (register uint32_t i = 0; i < a_data.size(); i++)
+		for (register uint64_t i = 0; i < uint64_t(a_length); i++)
 			hash = Bits::RotateLeft32(hash, 5) ^ a_data[i];
 		
 		return IHashResult(new HashResult(hash));
@@ -28,6 +28,13 @@ public:
 		name = __func__;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Jenkins3 &LSource = GetStateSource<Jenkins3>(a_source);
+
+		_list = LSource._list;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		Jenkins3 HashInstance;
@@ -43,12 +50,13 @@ public:
 	}
 
 protected:
-	virtual IHashResult ComputeAggregatedBytes(const HashLibByteArray &a_data)
+	virtual IHashResult ComputeAggregatedBytes(const uint8_t *a_data, const int64_t a_length)
 	{
-		register int32_t length, currentIndex, i1, i2, i3, i4;
+		register int64_t length, currentIndex;
+		register int32_t i1, i2, i3, i4;
 		register uint32_t a, b, c;
 		
-		length = (int32_t)a_data.size();
+		length = a_length;
 		if (length == 0)
 			return IHashResult(new HashResult(uint32_t(0)));
 		
@@ -39,6 +39,16 @@ public:
 		return hash;
 	}
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Murmur2 &LSource = GetStateSource<Murmur2>(a_source);
+
+		key = LSource.key;
+		working_key = LSource.working_key;
+		h = LSource.h;
+		_list = LSource._list;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		IHash hash = make_shared<Murmur2>(Copy());
@@ -54,9 +64,9 @@ public:
 	} // end function Initialize
 
 protected:
-	virtual IHashResult ComputeAggregatedBytes(const HashLibByteArray &a_data)
+	virtual IHashResult ComputeAggregatedBytes(const uint8_t *a_data, const int64_t a_length)
 	{
-		return IHashResult(new HashResult(InternalComputeBytes(a_data)));
+		return IHashResult(new HashResult(InternalComputeBytes(a_data, a_length)));
 	} // end function ComputeAggregatedBytes
 
 private:
@@ -74,13 +84,13 @@ private:
 		return HashInstance;
 	}
 
-	int32_t InternalComputeBytes(const HashLibByteArray &a_data)
+	int32_t InternalComputeBytes(const uint8_t *a_data, const int64_t a_length)
 	{
-		register int32_t Length, current_index;
+		register int64_t Length, current_index;
 		register uint32_t k;
 
-		Length = (int32_t)a_data.size();
-		const uint8_t *ptr_a_data = &a_data[0];
+		Length = a_length;
+		const uint8_t *ptr_a_data = a_data;
 
 		if (Length == 0)
 			return 0;
@@ -41,6 +41,17 @@ public:
 		return hash;
 	}
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const MurmurHash3_x86_32 &LSource = GetStateSource<MurmurHash3_x86_32>(a_source);
+
+		key = LSource.key;
+		h = LSource.h;
+		total_length = LSource.total_length;
+		idx = LSource.idx;
+		buf = LSource.buf;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		IHash hash = make_shared<MurmurHash3_x86_32>(Copy());
@@ -56,16 +67,17 @@ public:
 		idx = 0;
 	} // end function Initialize
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
-		register int32_t len, nBlocks, i, offset;
+		register int64_t index, len, nBlocks, i, offset;
 		register uint32_t k;
 		const uint8_t *ptr_a_data;
 
 		len = a_length;
-		i = a_index;
-		ptr_a_data = &a_data[0];
-		total_length += len;
+		i = 0;
+		index = 0;
+		ptr_a_data = a_data;
+		total_length += uint32_t(len);
         
         //consume last pending bytes
         if (idx != 0 && a_length != 0)
@@ -81,12 +93,11 @@ public:
                  ...
                  idx = 2, len = 6 -> [0, 2[ + [0, 2[ => Block = [2,6[, buf []
             */
-            //assert(a_index == 0); //nothing would work anyways if a_index is !=0
 			
             while (idx < 4 && len != 0)
             {
-                buf[idx++] = *(ptr_a_data + a_index);
-                a_index++;
+                buf[idx++] = *(ptr_a_data + index);
+                index++;
                 len--;
             }
             
@@ -98,10 +109,6 @@ public:
                 idx = 0;
             }
         } 
-		else
-		{
-			i = 0;
-		}
 
         nBlocks = (len) >> 2;
         offset = 0;
@@ -109,14 +116,14 @@ public:
 		// body
 		while (i < nBlocks)
 		{
-			k = Converters::ReadBytesAsUInt32LE(ptr_a_data, a_index + (i * 4));
+			k = Converters::ReadBytesAsUInt32LE(ptr_a_data, index + (i * 4));
 			TransformUInt32Fast(k);
 			i++;
 		} // end while
 
         //save pending end bytes
-        offset = a_index + (i * 4);
-		while (offset < (len + a_index))
+        offset = index + (i * 4);
+		while (offset < (len + index))
 		{
 			ByteUpdate(a_data[offset]);
 			offset++;
@@ -135,6 +142,17 @@ public:
 		return result;
 	} // end function TransformFinal
 
+	virtual void TransformFinalInto(uint8_t *a_output, const size_t a_output_length)
+	{
+		ValidateOutputLength(a_output_length);
+
+		Finish();
+
+		Converters::ReadUInt32AsBytesBE(h, a_output, 0);
+
+		Initialize();
+	} // end function TransformFinalInto
+
 private:
 
 	MurmurHash3_x86_32 Copy() const
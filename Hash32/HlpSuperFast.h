@@ -28,6 +28,13 @@ public:
 		name = __func__;
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const SuperFast &LSource = GetStateSource<SuperFast>(a_source);
+
+		_list = LSource._list;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		SuperFast HashInstance;
@@ -43,12 +50,13 @@ public:
 	}
 
 protected:
-	virtual IHashResult ComputeAggregatedBytes(const HashLibByteArray &a_data)
+	virtual IHashResult ComputeAggregatedBytes(const uint8_t *a_data, const int64_t a_length)
 	{
 		register uint32_t hash, tmp, u1;
-		register int32_t Length, currentIndex, i1, i2;
+		register int64_t Length, currentIndex;
+		register int32_t i1, i2;
 		
-		Length = (int32_t)a_data.size();
+		Length = a_length;
 
 		if (Length == 0)
 			return make_shared<HashResult>(int32_t(0));
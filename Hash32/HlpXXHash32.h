@@ -31,7 +31,7 @@ public:
 		name = __func__;
 
 		key = CKEY;
-		memory = make_shared<HashLibByteArray>(16);
+		memory.fill(0);
 	} // end constructor
 
 	virtual IHashWithKey CloneHashWithKey() const
@@ -42,6 +42,21 @@ public:
 		return hash;
 	}
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const XXHash32 &LSource = GetStateSource<XXHash32>(a_source);
+
+		key = LSource.key;
+		hash = LSource.hash;
+		total_len = LSource.total_len;
+		memsize = LSource.memsize;
+		v1 = LSource.v1;
+		v2 = LSource.v2;
+		v3 = LSource.v3;
+		v4 = LSource.v4;
+		memory = LSource.memory;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		IHash hash = make_shared<XXHash32>(Copy());
@@ -61,17 +76,17 @@ public:
 		memsize = 0;
 	} // end function Initialize
 	
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
 		register uint32_t _v1, _v2, _v3, _v4;
 
-		const uint8_t *ptrBuffer = &a_data[a_index];
-		uint8_t * ptrTemp, *ptrMemory = &(*memory)[0];
+		const uint8_t *ptrBuffer = a_data;
+		uint8_t * ptrTemp, *ptrMemory = &memory[0];
 		total_len = total_len + uint64_t(a_length);
 
-		if ((memsize + uint32_t(a_length)) < uint32_t(16))
+		if ((uint64_t(memsize) + uint64_t(a_length)) < uint64_t(16))
 		{
-			ptrTemp = (uint8_t *)&(*memory)[0] + memsize;
+			ptrTemp = (uint8_t *)&memory[0] + memsize;
 
 			memmove(ptrTemp, ptrBuffer, a_length);
 
@@ -80,11 +95,11 @@ public:
 			return;
 		} // end if
 
-		const uint8_t * ptrEnd = ptrBuffer + uint32_t(a_length);
+		const uint8_t * ptrEnd = ptrBuffer + a_length;
 
 		if (memsize > 0)
 		{
-			ptrTemp = (uint8_t *)&(*memory)[0] + memsize;
+			ptrTemp = (uint8_t *)&memory[0] + memsize;
 
 			memmove(ptrTemp, ptrBuffer, 16 - memsize);
 
@@ -124,13 +139,60 @@ public:
 
 		if (ptrBuffer < ptrEnd)
 		{
-			ptrTemp = &(*memory)[0];
+			ptrTemp = &memory[0];
 			memmove(ptrTemp, ptrBuffer, ptrEnd - ptrBuffer);
 			memsize = ptrEnd - ptrBuffer;
 		} // end if
 	} // end function TransformBytes
 
 	virtual IHashResult TransformFinal()
+	{
+		Finish();
+
+		IHashResult result = make_shared<HashResult>(hash);
+
+		Initialize();
+
+		return result;
+	} // end function TransformFinal
+
+	virtual void TransformFinalInto(uint8_t *a_output, const size_t a_output_length)
+	{
+		ValidateOutputLength(a_output_length);
+
+		Finish();
+
+		Converters::ReadUInt32AsBytesBE(hash, a_output, 0);
+
+		Initialize();
+	} // end function TransformFinalInto
+
+protected:
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		a_writer.Write(total_len);
+		a_writer.Write(memsize);
+		a_writer.Write(v1);
+		a_writer.Write(v2);
+		a_writer.Write(v3);
+		a_writer.Write(v4);
+		a_writer.Write(memory);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		a_reader.Read(total_len);
+		a_reader.Read(memsize);
+		a_reader.Check(memsize < 16);
+		a_reader.Read(v1);
+		a_reader.Read(v2);
+		a_reader.Read(v3);
+		a_reader.Read(v4);
+		a_reader.Read(memory);
+	} // end function ReadState
+
+private:
+	void Finish()
 	{
 		uint8_t *ptrEnd, *ptrBuffer;
 		
@@ -142,7 +204,7 @@ public:
 		
 		hash += total_len;
 
-		ptrBuffer = &(*memory)[0];
+		ptrBuffer = &memory[0];
 
 		ptrEnd = ptrBuffer + memsize;
 		while ((ptrBuffer + 4) <= ptrEnd)
@@ -164,15 +226,8 @@ public:
 		hash = hash ^ (hash >> 13);
 		hash = hash * PRIME32_3;
 		hash = hash ^ (hash >> 16);
+	} // end function Finish
 
-		IHashResult result = make_shared<HashResult>(hash);
-			
-		Initialize();
-		
-		return result;
-	} // end function TransformFinal
-
-private:
 	XXHash32 Copy() const
 	{
 		XXHash32 HashInstance;
@@ -226,7 +281,7 @@ private:
 
 	uint64_t total_len;
 	uint32_t memsize, v1, v2, v3, v4;
-	shared_ptr<HashLibByteArray> memory;
+	array<uint8_t, 16> memory;
 
 	static const char *InvalidKeyLength;
 
@@ -40,6 +40,15 @@ public:
 		return hash;
 	}
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const Murmur2_64 &LSource = GetStateSource<Murmur2_64>(a_source);
+
+		key = LSource.key;
+		working_key = LSource.working_key;
+		_list = LSource._list;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		IHash hash = make_shared<Murmur2_64>(Copy());
@@ -55,13 +64,13 @@ public:
 	} // end function Initialize
 
 protected:
-	virtual IHashResult ComputeAggregatedBytes(const HashLibByteArray &a_data)
+	virtual IHashResult ComputeAggregatedBytes(const uint8_t *a_data, const int64_t a_length)
 	{
-		register int32_t Length, current_index;
+		register int64_t Length, current_index;
 		register uint64_t k, h;
 
-		Length = (int32_t)a_data.size();
-		const uint8_t * ptr_a_data = &a_data[0];
+		Length = a_length;
+		const uint8_t * ptr_a_data = a_data;
 
 		if (Length == 0)
 			return make_shared<HashResult>(uint64_t(0));
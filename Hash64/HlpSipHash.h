@@ -51,32 +51,27 @@ public:
 		v0 = v0 ^ key0;
 	} // end function Initialize
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
-		register int32_t i, Length, iter, offset;
-		const uint8_t *ptr_a_data = &a_data[0];
+		register int64_t index, i, Length, iter, offset;
+		const uint8_t *ptr_a_data = a_data;
 
 
 		Length = a_length;
-		i = a_index;
+		i = 0;
+		index = 0;
 
-		total_length += Length;
+		total_length += uint64_t(Length);
 
 		// consume last pending bytes
 
 		if ((idx != 0) && (a_length != 0))
 		{
-			#ifdef DEBUG
-
-			assert(a_index == 0); // nothing would work anyways if a_index is !=0
-
-			#endif // DEBUG
-
 			while ((idx < 8) && (Length != 0))
 			{
-				buf[idx] = *(ptr_a_data + a_index);
+				buf[idx] = *(ptr_a_data + index);
 				idx++;
-				a_index++;
+				index++;
 				Length--;
 			}
 			if (idx == 8)
@@ -87,10 +82,6 @@ public:
 				idx = 0;
 			}
 		}
-		else
-		{
-			i = 0;
-		}
 
 		iter = Length >> 3;
 
@@ -98,15 +89,15 @@ public:
 
 		while (i < iter)
 		{
-			m = Converters::ReadBytesAsUInt64LE(ptr_a_data, a_index + (i * 8));
+			m = Converters::ReadBytesAsUInt64LE(ptr_a_data, index + (i * 8));
 			ProcessBlock(m);
 			i++;
 		} // end while
 
 		  // save pending end bytes
-		offset = a_index + (i * 8);
+		offset = index + (i * 8);
 
-		while (offset < (Length + a_index))
+		while (offset < (Length + index))
 		{
 			ByteUpdate(a_data[offset]);
 			offset++;
@@ -124,6 +115,17 @@ public:
 		return result;
 	} // end function TransformFinal
 
+	virtual void TransformFinalInto(uint8_t *a_output, const size_t a_output_length)
+	{
+		ValidateOutputLength(a_output_length);
+
+		Finish();
+
+		Converters::ReadUInt64AsBytesBE(v0 ^ v1 ^ v2 ^ v3, a_output, 0);
+
+		Initialize();
+	} // end function TransformFinalInto
+
 private:
 	inline void Compress()
 	{
@@ -308,6 +310,23 @@ public:
 		return hash;
 	}
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const SipHash2_4 &LSource = GetStateSource<SipHash2_4>(a_source);
+
+		v0 = LSource.v0;
+		v1 = LSource.v1;
+		v2 = LSource.v2;
+		v3 = LSource.v3;
+		key0 = LSource.key0;
+		key1 = LSource.key1;
+		total_length = LSource.total_length;
+		cr = LSource.cr;
+		fr = LSource.fr;
+		idx = LSource.idx;
+		buf = LSource.buf;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		IHash hash = make_shared<SipHash2_4>(Copy());
@@ -31,7 +31,7 @@ public:
 		name = __func__;
 
 		key = CKEY;
-		memory.resize(32);
+		memory.fill(0);
 	} // end constructor
 
 	virtual IHashWithKey CloneHashWithKey() const
@@ -42,6 +42,21 @@ public:
 		return hash;
 	}
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const XXHash64 &LSource = GetStateSource<XXHash64>(a_source);
+
+		key = LSource.key;
+		hash = LSource.hash;
+		total_len = LSource.total_len;
+		memsize = LSource.memsize;
+		v1 = LSource.v1;
+		v2 = LSource.v2;
+		v3 = LSource.v3;
+		v4 = LSource.v4;
+		memory = LSource.memory;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		IHash hash = make_shared<XXHash64>(Copy());
@@ -61,15 +76,15 @@ public:
 		memsize = 0;
 	} // end function Initialize
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
 		register uint64_t _v1, _v2, _v3, _v4;
 
-		const uint8_t *ptrBuffer = &a_data[a_index];
+		const uint8_t *ptrBuffer = a_data;
 		uint8_t * ptrTemp, *ptrMemory = &memory[0];
 		total_len = total_len + uint64_t(a_length);
 
-		if ((memsize + uint32_t(a_length)) < uint32_t(32))
+		if ((uint64_t(memsize) + uint64_t(a_length)) < uint64_t(32))
 		{
 			ptrTemp = (uint8_t *)&memory[0] + memsize;
 
@@ -80,7 +95,7 @@ public:
 			return;
 		} // end if
 
-		const uint8_t * ptrEnd = ptrBuffer + uint32_t(a_length);
+		const uint8_t * ptrEnd = ptrBuffer + a_length;
 
 		if (memsize > 0)
 		{
@@ -130,6 +145,53 @@ public:
 	} // end function TransformBytes
 
 	virtual IHashResult TransformFinal()
+	{
+		Finish();
+
+		IHashResult result = make_shared<HashResult>(hash);
+
+		Initialize();
+
+		return result;
+	} // end function TransformFinal
+
+	virtual void TransformFinalInto(uint8_t *a_output, const size_t a_output_length)
+	{
+		ValidateOutputLength(a_output_length);
+
+		Finish();
+
+		Converters::ReadUInt64AsBytesBE(hash, a_output, 0);
+
+		Initialize();
+	} // end function TransformFinalInto
+
+protected:
+	virtual void WriteState(HashStateWriter &a_writer) const
+	{
+		a_writer.Write(total_len);
+		a_writer.Write(memsize);
+		a_writer.Write(v1);
+		a_writer.Write(v2);
+		a_writer.Write(v3);
+		a_writer.Write(v4);
+		a_writer.Write(memory);
+	} // end function WriteState
+
+	virtual void ReadState(HashStateReader &a_reader)
+	{
+		a_reader.Read(total_len);
+		a_reader.Read(memsize);
+		a_reader.Check(memsize < 32);
+		a_reader.Read(v1);
+		a_reader.Read(v2);
+		a_reader.Read(v3);
+		a_reader.Read(v4);
+		a_reader.Read(memory);
+	} // end function ReadState
+
+private:
+	void Finish()
 	{
 		register uint64_t _v1, _v2, _v3, _v4;
 		uint8_t *ptrEnd, *ptrBuffer;
@@ -189,15 +251,8 @@ public:
 		hash = hash ^ (hash >> 29);
 		hash = hash * PRIME64_3;
 		hash = hash ^ (hash >> 32);
+	} // end function Finish
 
-		IHashResult result = make_shared<HashResult>(hash);
-
-		Initialize();
-
-		return result;
-	} // end function TransformFinal
-
-private:
 	XXHash64 Copy() const
 	{
 		XXHash64 HashInstance;
@@ -251,7 +306,7 @@ private:
 
 	uint64_t total_len, v1, v2, v3, v4;
 	uint32_t memsize;
-	HashLibByteArray memory;
+	array<uint8_t, 32> memory;
 
 	static const char *InvalidKeyLength;
 
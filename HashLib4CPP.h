@@ -99,6 +99,19 @@
 #include "KDF/HlpPBKDF2_HMACNotBuildInAdapter.h"
 // NullDigest
 #include "NullDigest/HlpNullDigest.h"
+// Batch
+#include "Base/HlpFileBatch.h"
+#include "Crypto/HlpMD5MultiBuffer.h"
+#include "Crypto/HlpSHA1MultiBuffer.h"
+#include "Crypto/HlpSHA2_256MultiBuffer.h"
+// Hashing Streams
+#include "Base/HlpHashingStream.h"
+// Pools
+#include "Base/HlpHashPool.h"
+// Value Types
+#include "Base/HlpStaticHash.h"
+// Compile Time Hashing
+#include "Base/HlpConstexprHash.h"
 
 
 namespace HashLib4CPP
@@ -909,6 +922,265 @@ namespace HashLib4CPP
 
 	}
 
+	  // ====================== Batch ======================
+	namespace Batch
+	{
+		/// <summary>
+		/// Computes the hash of every file in a_file_names with clones of a_hash,
+		/// keeping many opens and reads in flight. Files that could not be read
+		/// get a nullptr result.
+		/// </summary>
+		/// <param name="a_hash">The "IHash" to clone for every worker thread.</param>
+		/// <param name="a_file_names">The files to hash.</param>
+		/// <param name="a_threads">The number of hashing threads, 0 for one per core.</param>
+		/// <exception cref="ArgumentNilHashLibException">The hash is Nil.</exception>
+		static HashLibHashResultArray ComputeFiles(const IHash &a_hash,
+			const HashLibStringArray &a_file_names, const int32_t a_threads = 0)
+		{
+			return FileBatch::ComputeFiles(a_hash, a_file_names, a_threads);
+		} // end function ComputeFiles
+
+		/// <summary>
+		/// Computes the MD5 digest of every message, several messages per
+		/// pass in the lanes of the widest vector unit available.
+		/// </summary>
+		/// <exception cref="ArgumentHashLibException">A message has a negative length or no data.</exception>
+		static HashLibHashResultArray ComputeMD5(const HashLibSpanArray &a_messages)
+		{
+			return MD5MultiBuffer::Compute(a_messages);
+		} // end function ComputeMD5
+
+		/// <summary>
+		/// Like "ComputeMD5", writing the digests back to back to a_digests,
+		/// which must hold a_count * 16 bytes.
+		/// </summary>
+		static void ComputeMD5Into(const HashLibSpan *a_messages, const size_t a_count,
+			uint8_t *a_digests)
+		{
+			MD5MultiBuffer::ComputeInto(a_messages, a_count, a_digests);
+		} // end function ComputeMD5Into
+
+		/// <summary>
+		/// Computes the SHA-1 digest of every message, several messages per
+		/// pass in the lanes of the widest vector unit available, or one at
+		/// a time on the SHA extensions where those are present.
+		/// </summary>
+		/// <exception cref="ArgumentHashLibException">A message has a negative length or no data.</exception>
+		static HashLibHashResultArray ComputeSHA1(const HashLibSpanArray &a_messages)
+		{
+			return SHA1MultiBuffer::Compute(a_messages);
+		} // end function ComputeSHA1
+
+		/// <summary>
+		/// Like "ComputeSHA1", writing the digests back to back to a_digests,
+		/// which must hold a_count * 20 bytes.
+		/// </summary>
+		static void ComputeSHA1Into(const HashLibSpan *a_messages, const size_t a_count,
+			uint8_t *a_digests)
+		{
+			SHA1MultiBuffer::ComputeInto(a_messages, a_count, a_digests);
+		} // end function ComputeSHA1Into
+
+		/// <summary>
+		/// Computes the SHA-224 digest of every message, several messages per
+		/// pass in the lanes of the widest vector unit available, or one at
+		/// a time on the SHA extensions where those are present.
+		/// </summary>
+		/// <exception cref="ArgumentHashLibException">A message has a negative length or no data.</exception>
+		static HashLibHashResultArray ComputeSHA2_224(const HashLibSpanArray &a_messages)
+		{
+			return SHA2_256MultiBuffer::Compute(a_messages, 28);
+		} // end function ComputeSHA2_224
+
+		/// <summary>
+		/// Like "ComputeSHA2_224", writing the digests back to back to
+		/// a_digests, which must hold a_count * 28 bytes.
+		/// </summary>
+		static void ComputeSHA2_224Into(const HashLibSpan *a_messages, const size_t a_count,
+			uint8_t *a_digests)
+		{
+			SHA2_256MultiBuffer::ComputeInto(a_messages, a_count, a_digests, 28);
+		} // end function ComputeSHA2_224Into
+
+		/// <summary>
+		/// Computes the SHA-256 digest of every message, several messages per
+		/// pass in the lanes of the widest vector unit available, or one at
+		/// a time on the SHA extensions where those are present.
+		/// </summary>
+		/// <exception cref="ArgumentHashLibException">A message has a negative length or no data.</exception>
+		static HashLibHashResultArray ComputeSHA2_256(const HashLibSpanArray &a_messages)
+		{
+			return SHA2_256MultiBuffer::Compute(a_messages, 32);
+		} // end function ComputeSHA2_256
+
+		/// <summary>
+		/// Like "ComputeSHA2_256", writing the digests back to back to
+		/// a_digests, which must hold a_count * 32 bytes.
+		/// </summary>
+		static void ComputeSHA2_256Into(const HashLibSpan *a_messages, const size_t a_count,
+			uint8_t *a_digests)
+		{
+			SHA2_256MultiBuffer::ComputeInto(a_messages, a_count, a_digests, 32);
+		} // end function ComputeSHA2_256Into
+	} // end namespace Batch
+
+	  // ====================== Pool ======================
+	namespace Pool
+	{
+		/// <summary>
+		/// Takes an instance made by a_factory from the calling thread's free
+		/// list, constructing one only when the list is empty. The instance is
+		/// already initialized and goes back to the list when the returned
+		/// handle is destroyed.
+		/// </summary>
+		/// <param name="a_factory">Any factory function without arguments, e.g. "Crypto::CreateSHA2_256".</param>
+		static PooledHash<IHash> Acquire(IHash (*a_factory)())
+		{
+			return HashPool<IHash>::Acquire(a_factory);
+		} // end function Acquire
+
+		/// <summary>
+		/// Keyed variant of "Acquire"; the instance always carries the
+		/// factory's default key, whatever key its previous user set.
+		/// </summary>
+		/// <param name="a_factory">Any keyed factory function without arguments, e.g. "Hash32::CreateXXHash32".</param>
+		static PooledHash<IHashWithKey> Acquire(IHashWithKey (*a_factory)())
+		{
+			return HashPool<IHashWithKey>::Acquire(a_factory);
+		} // end function Acquire
+	} // end namespace Pool
+
+	  // ====================== Static ======================
+	/// <summary>
+	/// The algorithms as final, stack allocatable value types with statically
+	/// bound Update, Final and Compute members, for hot loops where the virtual
+	/// calls and reference counting of "IHash" cost more than the hash itself.
+	/// </summary>
+	namespace Static
+	{
+		// Checksum
+		typedef StaticHash< ::_CRC16_BUYPASS > CRC16_BUYPASS;
+		typedef StaticHash< ::_CRC32_PKZIP > CRC32_PKZIP;
+		typedef StaticHash< ::_CRC32_CASTAGNOLI > CRC32_CASTAGNOLI;
+		typedef StaticHash< ::_CRC64_ECMA > CRC64_ECMA;
+		typedef StaticHash< ::Adler32 > Adler32;
+
+		// Hash32
+		typedef StaticHash< ::AP > AP;
+		typedef StaticHash< ::Bernstein > Bernstein;
+		typedef StaticHash< ::Bernstein1 > Bernstein1;
+		typedef StaticHash< ::BKDR > BKDR;
+		typedef StaticHash< ::DEK > DEK;
+		typedef StaticHash< ::DJB > DJB;
+		typedef StaticHash< ::ELF > ELF;
+		typedef StaticHash< ::FNV > FNV;
+		typedef StaticHash< ::FNV1a > FNV1a;
+		typedef StaticHash< ::Jenkins3 > Jenkins3;
+		typedef StaticHash< ::JS > JS;
+		typedef StaticHash< ::Murmur2 > Murmur2;
+		typedef StaticHash< ::MurmurHash3_x86_32 > MurmurHash3_x86_32;
+		typedef StaticHash< ::OneAtTime > OneAtTime;
+		typedef StaticHash< ::PJW > PJW;
+		typedef StaticHash< ::Rotating > Rotating;
+		typedef StaticHash< ::RS > RS;
+		typedef StaticHash< ::SDBM > SDBM;
+		typedef StaticHash< ::ShiftAndXor > ShiftAndXor;
+		typedef StaticHash< ::SuperFast > SuperFast;
+		typedef StaticHash< ::XXHash32 > XXHash32;
+
+		// Hash64
+		typedef StaticHash< ::FNV64 > FNV64;
+		typedef StaticHash< ::FNV1a64 > FNV1a64;
+		typedef StaticHash< ::Murmur2_64 > Murmur2_64;
+		typedef StaticHash< ::SipHash2_4 > SipHash2_4;
+		typedef StaticHash< ::XXHash64 > XXHash64;
+
+		// Hash128
+		typedef StaticHash< ::MurmurHash3_x86_128 > MurmurHash3_x86_128;
+		typedef StaticHash< ::MurmurHash3_x64_128 > MurmurHash3_x64_128;
+
+		// Crypto
+		typedef StaticHash< ::Tiger_3_128 > Tiger_3_128;
+		typedef StaticHash< ::Tiger_3_160 > Tiger_3_160;
+		typedef StaticHash< ::Tiger_3_192 > Tiger_3_192;
+		typedef StaticHash< ::Tiger_4_128 > Tiger_4_128;
+		typedef StaticHash< ::Tiger_4_160 > Tiger_4_160;
+		typedef StaticHash< ::Tiger_4_192 > Tiger_4_192;
+		typedef StaticHash< ::Tiger_5_128 > Tiger_5_128;
+		typedef StaticHash< ::Tiger_5_160 > Tiger_5_160;
+		typedef StaticHash< ::Tiger_5_192 > Tiger_5_192;
+		typedef StaticHash< ::Tiger2_3_128 > Tiger2_3_128;
+		typedef StaticHash< ::Tiger2_3_160 > Tiger2_3_160;
+		typedef StaticHash< ::Tiger2_3_192 > Tiger2_3_192;
+		typedef StaticHash< ::Tiger2_4_128 > Tiger2_4_128;
+		typedef StaticHash< ::Tiger2_4_160 > Tiger2_4_160;
+		typedef StaticHash< ::Tiger2_4_192 > Tiger2_4_192;
+		typedef StaticHash< ::Tiger2_5_128 > Tiger2_5_128;
+		typedef StaticHash< ::Tiger2_5_160 > Tiger2_5_160;
+		typedef StaticHash< ::Tiger2_5_192 > Tiger2_5_192;
+		typedef StaticHash< ::MD2 > MD2;
+		typedef StaticHash< ::MD4 > MD4;
+		typedef StaticHash< ::MD5 > MD5;
+		typedef StaticHash< ::SHA0 > SHA0;
+		typedef StaticHash< ::SHA1 > SHA1;
+		typedef StaticHash< ::SHA2_224 > SHA2_224;
+		typedef StaticHash< ::SHA2_256 > SHA2_256;
+		typedef StaticHash< ::SHA2_384 > SHA2_384;
+		typedef StaticHash< ::SHA2_512 > SHA2_512;
+		typedef StaticHash< ::SHA2_512_224 > SHA2_512_224;
+		typedef StaticHash< ::SHA2_512_256 > SHA2_512_256;
+		typedef StaticHash< ::Grindahl256 > Grindahl256;
+		typedef StaticHash< ::Grindahl512 > Grindahl512;
+		typedef StaticHash< ::Panama > Panama;
+		typedef StaticHash< ::WhirlPool > WhirlPool;
+		typedef StaticHash< ::RadioGatun32 > RadioGatun32;
+		typedef StaticHash< ::RadioGatun64 > RadioGatun64;
+		typedef StaticHash< ::Haval_3_128 > Haval_3_128;
+		typedef StaticHash< ::Haval_4_128 > Haval_4_128;
+		typedef StaticHash< ::Haval_5_128 > Haval_5_128;
+		typedef StaticHash< ::Haval_3_160 > Haval_3_160;
+		typedef StaticHash< ::Haval_4_160 > Haval_4_160;
+		typedef StaticHash< ::Haval_5_160 > Haval_5_160;
+		typedef StaticHash< ::Haval_3_192 > Haval_3_192;
+		typedef StaticHash< ::Haval_4_192 > Haval_4_192;
+		typedef StaticHash< ::Haval_5_192 > Haval_5_192;
+		typedef StaticHash< ::Haval_3_224 > Haval_3_224;
+		typedef StaticHash< ::Haval_4_224 > Haval_4_224;
+		typedef StaticHash< ::Haval_5_224 > Haval_5_224;
+		typedef StaticHash< ::Haval_3_256 > Haval_3_256;
+		typedef StaticHash< ::Haval_4_256 > Haval_4_256;
+		typedef StaticHash< ::Haval_5_256 > Haval_5_256;
+		typedef StaticHash< ::Gost > Gost;
+		typedef StaticHash< ::GOST3411_2012_256 > GOST3411_2012_256;
+		typedef StaticHash< ::GOST3411_2012_512 > GOST3411_2012_512;
+		typedef StaticHash< ::HAS160 > HAS160;
+		typedef StaticHash< ::RIPEMD > RIPEMD;
+		typedef StaticHash< ::RIPEMD128 > RIPEMD128;
+		typedef StaticHash< ::RIPEMD160 > RIPEMD160;
+		typedef StaticHash< ::RIPEMD256 > RIPEMD256;
+		typedef StaticHash< ::RIPEMD320 > RIPEMD320;
+		typedef StaticHash< ::SHA3_224 > SHA3_224;
+		typedef StaticHash< ::SHA3_256 > SHA3_256;
+		typedef StaticHash< ::SHA3_384 > SHA3_384;
+		typedef StaticHash< ::SHA3_512 > SHA3_512;
+		typedef StaticHash< ::Keccak_224 > Keccak_224;
+		typedef StaticHash< ::Keccak_256 > Keccak_256;
+		typedef StaticHash< ::Keccak_384 > Keccak_384;
+		typedef StaticHash< ::Keccak_512 > Keccak_512;
+		typedef StaticHash< ::Blake2B > Blake2B;
+		typedef StaticHash< ::Blake2S > Blake2S;
+	} // end namespace Static
+
+	  // ====================== Constexpr ======================
+	/// <summary>
+	/// Compile time FNV, FNV1a, DJB, SDBM, MurmurHash3_x86_32, XXHash32,
+	/// CRC32, FNV64, FNV1a64 and XXHash64 of string keys, equal to the
+	/// results of the matching runtime classes, e.g.
+	/// "case Constexpr::FNV1a("GET"):".
+	/// </summary>
+	typedef ::ConstexprHash Constexpr;
+
+
 } // end namespace HashLib4CPP
 
 
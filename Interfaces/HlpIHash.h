@@ -18,43 +18,80 @@
 
 #include <fstream>
 #include "HlpIHashResult.h"
+#include "../Utils/HlpHashValue.h"
 #include "../Utils/HlpHashLibTypes.h"
+#include "../Utils/HlpMemoryResource.h"
 
 class IIHash;
 
+// POSIX scatter-gather element, only complete where <sys/uio.h> exists
+struct iovec;
+
 typedef shared_ptr<IIHash> IHash;
 
+/// <summary>
+/// Represents a dynamic array of IHash.
+/// </summary>
+typedef vector<IHash> HashLibHashArray;
+
 
 class IIHash
 {
 public:
 	virtual string GetName() const = 0;
+	virtual string GetKernelName() const = 0;
 	virtual int32_t GetBlockSize() const = 0;
 	virtual int32_t GetHashSize() const = 0;
 	virtual int32_t GetBufferSize() const = 0;
 	virtual void SetBufferSize(const int32_t value) = 0;
+	virtual int32_t GetReadAheadDepth() const = 0;
+	virtual void SetReadAheadDepth(const int32_t value) = 0;
+	virtual FileReadMode GetFileReadMode() const = 0;
+	virtual void SetFileReadMode(const FileReadMode value) = 0;
 
 	virtual IHash Clone() const = 0;
+	virtual void CopyStateFrom(const IIHash &a_source) = 0;
+	virtual HashLibByteArray SaveState() const = 0;
+	virtual void RestoreState(const HashLibByteArray &a_state) = 0;
 
 	virtual IHashResult ComputeString(const string &a_data) = 0;
 	virtual IHashResult ComputeBytes(const HashLibByteArray &a_data) = 0;
 	virtual IHashResult ComputeUntyped(const void *a_data, const int64_t a_length) = 0;
+	virtual void ComputeInto(const void *a_data, const int64_t a_length,
+		uint8_t *a_output, const size_t a_output_length) = 0;
+	virtual HashValue ComputeValue(const void *a_data, const int64_t a_length) = 0;
+	virtual IHashResult ComputeUntypedIn(const void *a_data, const int64_t a_length,
+		MemoryResource &a_resource) = 0;
+	virtual IHashResult ComputeSpans(const HashLibSpanArray &a_spans) = 0;
 	virtual IHashResult ComputeStream(ifstream &a_stream, const int64_t a_length = -1) = 0;
+	virtual IHashResult ComputeStream(istream &a_stream, const int64_t a_length = -1) = 0;
+	virtual IHashResult ComputeStream(streambuf &a_stream, const int64_t a_length = -1) = 0;
+	virtual IHashResult ComputeDescriptor(const int a_handle, const int64_t a_length = -1) = 0;
 	virtual IHashResult ComputeFile(const string &a_file_name,
 		const int64_t a_from = 0, const int64_t a_length = -1) = 0;
 
 	virtual void Initialize() = 0;
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length) = 0;
-	virtual void TransformBytes(const HashLibByteArray &a_data, const int32_t a_index) = 0;
+	virtual void TransformBytes(const HashLibByteArray &a_data, int64_t a_index, int64_t a_length) = 0;
+	virtual void TransformBytes(const HashLibByteArray &a_data, const int64_t a_index) = 0;
 	virtual void TransformBytes(const HashLibByteArray &a_data) = 0;
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length) = 0;
 	
 	virtual void TransformUntyped(const void *a_data, const int64_t a_length) = 0;
+	virtual void TransformSpans(const HashLibSpan *a_spans, const size_t a_count) = 0;
+	virtual void TransformSpans(const HashLibSpanArray &a_spans) = 0;
+	virtual void TransformIov(const struct iovec *a_iov, const size_t a_count) = 0;
 
 	virtual IHashResult TransformFinal() = 0;
+	virtual void TransformFinalInto(uint8_t *a_output, const size_t a_output_length) = 0;
+	virtual HashValue TransformFinalValue() = 0;
+	virtual IHashResult TransformFinalIn(MemoryResource &a_resource) = 0;
 
 	virtual void TransformString(const string &a_data) = 0;
 	virtual void TransformStream(ifstream &a_stream, const int64_t a_length = -1) = 0;
+	virtual void TransformStream(istream &a_stream, const int64_t a_length = -1) = 0;
+	virtual void TransformStream(streambuf &a_stream, const int64_t a_length = -1) = 0;
+	virtual void TransformDescriptor(const int a_handle, const int64_t a_length = -1) = 0;
 	virtual void TransformFile(const string &a_file_name,
 		const int64_t a_from = 0, const int64_t a_length = -1) = 0;
 
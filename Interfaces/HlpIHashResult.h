@@ -22,6 +22,11 @@ class IIHashResult;
 
 typedef shared_ptr<IIHashResult> IHashResult;
 
+/// <summary>
+/// Represents a dynamic array of IHashResult.
+/// </summary>
+typedef vector<IHashResult> HashLibHashResultArray;
+
 class IIHashResult
 {
 public:
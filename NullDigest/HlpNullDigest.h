@@ -33,6 +33,15 @@ public:
 		Out = make_shared<stringstream>();
 	} // end constructor
 
+	virtual void CopyStateFrom(const IIHash &a_source)
+	{
+		const NullDigest &LSource = GetStateSource<NullDigest>(a_source);
+
+		Out->str(LSource.Out->str());
+		hash_size = LSource.hash_size;
+		block_size = LSource.block_size;
+	} // end function CopyStateFrom
+
 	virtual IHash Clone() const
 	{
 		NullDigest HashInstance = NullDigest();
@@ -67,15 +76,10 @@ public:
 		return result;
 	} // end function TransformFinal
 
-	virtual void TransformBytes(const HashLibByteArray &a_data, int32_t a_index, int32_t a_length)
+	virtual void TransformBytes(const uint8_t *a_data, int64_t a_length)
 	{
-		if (!a_data.empty())
-		{
-			const HashLibByteArray::const_iterator start = a_data.begin() + a_index;
-			const HashLibByteArray::const_iterator end = start + a_length;
-
-			*Out << string(start, end);
-		}
+		if (a_data)
+			Out->write((const char *)a_data, a_length);
 		
 		hash_size = int32_t(GetStreamSize(*Out));
 	} // end function TransformBytes
@@ -122,5 +122,28 @@ BOOST_AUTO_TEST_CASE(TestCheckValueWithIncrementalHash)
 	} // end for
 }
 
+BOOST_AUTO_TEST_CASE(TestStaticCopyIsIndependent)
+{
+	string ExpectedCRCOfDefaultData = HashLib4CPP::Checksum::CreateCRC32_PKZIP()->ComputeString(DefaultData)->ToString();
+	string ExpectedCRCOfOnetoNine = HashLib4CPP::Checksum::CreateCRC32_PKZIP()->ComputeString(DefaultData.substr(0, 10) + OnetoNine)->ToString();
+	HashLib4CPP::Static::CRC32_PKZIP crc;
+	crc.Update(DefaultData.data(), 10);
+	HashLib4CPP::Static::CRC32_PKZIP CRCCopy = crc;
+	CRCCopy.Update(OnetoNine.data(), int64_t(OnetoNine.size()));
+	crc.Update(DefaultData.data() + 10, int64_t(DefaultData.size()) - 10);
+	BOOST_CHECK(ExpectedCRCOfDefaultData == crc.FinalValue().ToString());
+	BOOST_CHECK(ExpectedCRCOfOnetoNine == CRCCopy.FinalValue().ToString());
+}
+
+BOOST_AUTO_TEST_CASE(TestConstexprMatchesRuntime)
+{
+	// usable where a constant expression is required
+	static_assert(HashLib4CPP::Constexpr::CRC32_PKZIP("123456789") == 0xCBF43926, "CRC32_PKZIP check value");
+	static_assert(HashLib4CPP::Constexpr::CRC32_CASTAGNOLI("123456789") == 0xE3069283, "CRC32_CASTAGNOLI check value");
+
+	ConstexprMatchesRuntime<uint32_t>(HashLib4CPP::Constexpr::CRC32_PKZIP, HashLib4CPP::Checksum::CreateCRC32_PKZIP());
+	ConstexprMatchesRuntime<uint32_t>(HashLib4CPP::Constexpr::CRC32_CASTAGNOLI, HashLib4CPP::Checksum::CreateCRC32_CASTAGNOLI());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -15,6 +15,7 @@
 
 #define BOOST_TEST_MODULE CryptoTestCase
 
+#include <sstream>
 #include "TestConstants.h"
 #include "Blake2BTestVectors.h"
 #include "Blake2STestVectors.h"
@@ -2489,6 +2490,36 @@ BOOST_AUTO_TEST_CASE(TestHMACCloneIsCorrect)
 	HMACCloneIsCorrect(hash);
 }
 
+BOOST_AUTO_TEST_CASE(TestMD5MultiBufferMatchesSerial)
+{
+	// MD5 has no SHA-NI kernel, only the AVX-512 and AVX2 lanes
+	const char *Withdrawn[] = { "", "avx512", "avx512,avx2", "all" };
+	HashLibByteArray Data(1000);
+	HashLibSpanArray Messages;
+
+	for (size_t i = 0; i < Data.size(); i++)
+		Data[i] = uint8_t(i * 7 + 3);
+
+	for (size_t i = 0; i < 150; i++)
+	{
+		HashLibSpan Message = { &Data[i], int64_t((i * 37) % 700) };
+		Messages.push_back(Message);
+	} // end for
+
+	uint32_t Disabled = CpuFeatures::GetDisabled();
+	for (const char *Names : Withdrawn)
+	{
+		CpuFeatures::SetDisabled(Disabled | CpuFeatures::ParseNames(Names));
+		HashLibHashResultArray Results = HashLib4CPP::Batch::ComputeMD5(Messages);
+		CpuFeatures::SetDisabled(Disabled);
+
+		for (size_t i = 0; i < Messages.size(); i++)
+			BOOST_CHECK(Results[i]->ToString() == md5->ComputeUntyped(Messages[i].data, Messages[i].length)->ToString());
+	} // end for
+
+	BOOST_CHECK(HashLib4CPP::Batch::ComputeMD5(HashLibSpanArray()).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -3528,6 +3559,35 @@ BOOST_AUTO_TEST_CASE(TestHMACCloneIsCorrect)
 	HMACCloneIsCorrect(hash);
 }
 
+BOOST_AUTO_TEST_CASE(TestSHA1MultiBufferMatchesSerial)
+{
+	const char *Withdrawn[] = { "", "sha", "sha,avx512", "all" };
+	HashLibByteArray Data(1000);
+	HashLibSpanArray Messages;
+
+	for (size_t i = 0; i < Data.size(); i++)
+		Data[i] = uint8_t(i * 7 + 3);
+
+	for (size_t i = 0; i < 150; i++)
+	{
+		HashLibSpan Message = { &Data[i], int64_t((i * 37) % 700) };
+		Messages.push_back(Message);
+	} // end for
+
+	uint32_t Disabled = CpuFeatures::GetDisabled();
+	for (const char *Names : Withdrawn)
+	{
+		CpuFeatures::SetDisabled(Disabled | CpuFeatures::ParseNames(Names));
+		HashLibHashResultArray Results = HashLib4CPP::Batch::ComputeSHA1(Messages);
+		CpuFeatures::SetDisabled(Disabled);
+
+		for (size_t i = 0; i < Messages.size(); i++)
+			BOOST_CHECK(Results[i]->ToString() == sha1->ComputeUntyped(Messages[i].data, Messages[i].length)->ToString());
+	} // end for
+
+	BOOST_CHECK(HashLib4CPP::Batch::ComputeSHA1(HashLibSpanArray()).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -3709,6 +3769,35 @@ BOOST_AUTO_TEST_CASE(TestIncrementalHash)
 	BOOST_CHECK(ExpectedHashOfDefaultData == ActualString);
 }
 
+BOOST_AUTO_TEST_CASE(TestPointerTransformBytes)
+{
+	IHash hash = HashLib4CPP::Crypto::CreateSHA2_256();
+	string Padded = "xyz" + DefaultData + "xyz";
+
+	hash->Initialize();
+	hash->TransformBytes((const uint8_t *)Padded.data(), 0);
+	string EmptyString = hash->TransformFinal()->ToString();
+
+	hash->Initialize();
+	hash->TransformBytes((const uint8_t *)Padded.data() + 3, (int64_t)DefaultData.size());
+	string OffsetString = hash->TransformFinal()->ToString();
+
+	hash->Initialize();
+	hash->TransformBytes((const uint8_t *)Padded.data() + 3, 5);
+	hash->TransformBytes((const uint8_t *)Padded.data() + 8, 0);
+	hash->TransformBytes((const uint8_t *)Padded.data() + 8, (int64_t)DefaultData.size() - 5);
+	string SplitString = hash->TransformFinal()->ToString();
+
+	hash->Initialize();
+	hash->TransformBytes(&Bytesabcde[0], (int64_t)Bytesabcde.size());
+	string abcdeString = hash->TransformFinal()->ToString();
+
+	BOOST_CHECK(ExpectedHashOfEmptyData == EmptyString);
+	BOOST_CHECK(ExpectedHashOfDefaultData == OffsetString);
+	BOOST_CHECK(ExpectedHashOfDefaultData == SplitString);
+	BOOST_CHECK(ExpectedHashOfabcde == abcdeString);
+}
+
 BOOST_AUTO_TEST_CASE(TestHashCloneIsCorrect)
 {
 	IHash hash = HashLib4CPP::Crypto::CreateSHA2_256();
@@ -3730,6 +3819,250 @@ BOOST_AUTO_TEST_CASE(TestHMACCloneIsCorrect)
 	HMACCloneIsCorrect(hash);
 }
 
+BOOST_AUTO_TEST_CASE(TestScatteredSpans)
+{
+	IHash hash = HashLib4CPP::Crypto::CreateSHA2_256();
+	HashLibSpanArray Spans;
+	string Data = "";
+	size_t offset = 0;
+
+	for (int32_t i = 0; i < 100; i++)
+		Data += DefaultData;
+
+	string ExpectedString = hash->ComputeString(Data)->ToString();
+
+	// fragments of uneven size, including an empty one, so that blocks
+	// straddle fragment boundaries
+	const size_t Sizes[] = { 3, 0, 61, 64, 1, 200, 7 };
+
+	for (size_t i = 0; offset < Data.size(); i++)
+	{
+		HashLibSpan Span = { (const uint8_t *)Data.data() + offset, 0 };
+
+		Span.length = int64_t(min(Sizes[i % 7], Data.size() - offset));
+		Spans.push_back(Span);
+		offset = offset + size_t(Span.length);
+	} // end for
+
+	string ActualString = hash->ComputeSpans(Spans)->ToString();
+
+	BOOST_CHECK(ExpectedString == ActualString);
+
+#ifdef HASHLIB_POSIX_IO
+	vector<struct iovec> Iov(Spans.size());
+
+	for (size_t i = 0; i < Spans.size(); i++)
+	{
+		Iov[i].iov_base = (void *)Spans[i].data;
+		Iov[i].iov_len = size_t(Spans[i].length);
+	} // end for
+
+	hash->Initialize();
+	hash->TransformIov(&Iov[0], Iov.size());
+	string ActualIovString = hash->TransformFinal()->ToString();
+
+	BOOST_CHECK(ExpectedString == ActualIovString);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(TestPooledHashIsReusedInitialized)
+{
+	IIHash *Instance;
+
+	{
+		PooledHash<IHash> hash = HashLib4CPP::Pool::Acquire(HashLib4CPP::Crypto::CreateSHA2_256);
+		Instance = hash.Get().get();
+		hash->TransformString(DefaultData); // left unfinished on purpose
+	}
+
+	PooledHash<IHash> hash = HashLib4CPP::Pool::Acquire(HashLib4CPP::Crypto::CreateSHA2_256);
+	BOOST_CHECK(Instance == hash.Get().get());
+
+	hash->TransformString(DefaultData);
+	BOOST_CHECK(ExpectedHashOfDefaultData == hash->TransformFinal()->ToString());
+}
+
+struct PooledHashHolder
+{
+	unique_ptr<PooledHash<IHash> > hash;
+};
+
+BOOST_AUTO_TEST_CASE(TestPooledHashOutlivingThreadPoolIsFreed)
+{
+	// the holder is constructed before the thread's free lists, so it is
+	// destroyed after them and must not release into the freed lists
+	thread LThread([]()
+	{
+		static thread_local PooledHashHolder LHolder;
+
+		LHolder.hash.reset(new PooledHash<IHash>(
+			HashLib4CPP::Pool::Acquire(HashLib4CPP::Crypto::CreateSHA2_256)));
+		LHolder.hash->Get()->TransformString(DefaultData);
+	});
+
+	LThread.join();
+
+	PooledHash<IHash> hash = HashLib4CPP::Pool::Acquire(HashLib4CPP::Crypto::CreateSHA2_256);
+	hash->TransformString(DefaultData);
+	BOOST_CHECK(ExpectedHashOfDefaultData == hash->TransformFinal()->ToString());
+}
+
+BOOST_AUTO_TEST_CASE(TestStaticHashMatchesIHash)
+{
+	uint8_t Output[32];
+	HashLib4CPP::Static::SHA2_256 hash;
+
+	hash.Update(DefaultData.data(), 10);
+	hash.Update(DefaultData.data() + 10, int64_t(DefaultData.size()) - 10);
+	hash.Final(Output);
+
+	BOOST_CHECK(ExpectedHashOfDefaultData == Converters::ConvertBytesToHexString(Output, 32, false));
+
+	hash.Compute(DefaultData.data(), int64_t(DefaultData.size()), Output);
+	BOOST_CHECK(ExpectedHashOfDefaultData == Converters::ConvertBytesToHexString(Output, 32, false));
+
+	// a copy carries the midstate like Clone() does
+	hash.Update(DefaultData.data(), 10);
+	HashLib4CPP::Static::SHA2_256 Copy = hash;
+	Copy.Update(DefaultData.data() + 10, int64_t(DefaultData.size()) - 10);
+	BOOST_CHECK(ExpectedHashOfDefaultData == Copy.FinalValue().ToString());
+}
+
+BOOST_AUTO_TEST_CASE(TestKernelSelectionFollowsCpuFeatures)
+{
+	IHash hash = HashLib4CPP::Crypto::CreateSHA2_256();
+	bool Registered = false;
+
+	BOOST_CHECK((CpuFeatures::GetEnabled() & ~CpuFeatures::GetDetected()) == 0);
+	BOOST_CHECK(CpuFeatures::ParseNames("SHA, avx2,unknown") == uint32_t(CpuSHA | CpuAVX2));
+	BOOST_CHECK(CpuFeatures::GetNames(CpuSHA | CpuAVX2) == "avx2 sha");
+
+	for (const HashKernel<SHA2_256Base::CompressFunction> &Kernel : SHA2_256Base::GetKernels().GetKernels())
+		Registered = Registered || hash->GetKernelName() == Kernel.name;
+	BOOST_CHECK(Registered);
+
+	BOOST_CHECK(HashLib4CPP::HMAC::CreateHMAC(hash)->GetKernelName() == hash->GetKernelName());
+
+	// with every feature withdrawn new instances fall back to portable code
+	uint32_t Disabled = CpuFeatures::GetDisabled();
+	CpuFeatures::SetDisabled(CpuFeatures::ParseNames("all"));
+	IHash Portable = HashLib4CPP::Crypto::CreateSHA2_256();
+	CpuFeatures::SetDisabled(Disabled);
+
+	BOOST_CHECK(Portable->GetKernelName() == "Portable");
+	BOOST_CHECK(ExpectedHashOfDefaultData == Portable->ComputeString(DefaultData)->ToString());
+	BOOST_CHECK(ExpectedHashOfDefaultData == hash->ComputeString(DefaultData)->ToString());
+}
+
+BOOST_AUTO_TEST_CASE(TestForcedKernelOverridesSelection)
+{
+	string Forced = CpuFeatures::GetForcedKernel();
+
+	BOOST_CHECK(CpuFeatures::SameName("portable", "Portable"));
+	BOOST_CHECK(!CpuFeatures::SameName("SHA", "SHA-NI"));
+
+	// the portable kernel needs nothing, so forcing it always wins
+	CpuFeatures::SetForcedKernel("portable");
+	IHash Portable = HashLib4CPP::Crypto::CreateSHA2_256();
+	// a name the table does not know leaves the normal selection
+	CpuFeatures::SetForcedKernel("no-such-kernel");
+	IHash Unknown = HashLib4CPP::Crypto::CreateSHA2_256();
+	CpuFeatures::SetForcedKernel("");
+	IHash Selected = HashLib4CPP::Crypto::CreateSHA2_256();
+	BOOST_CHECK(CpuFeatures::PeekForcedKernel() == nullptr);
+	CpuFeatures::SetForcedKernel(Forced);
+
+	BOOST_CHECK(Portable->GetKernelName() == "Portable");
+	BOOST_CHECK(Unknown->GetKernelName() == Selected->GetKernelName());
+	BOOST_CHECK(CpuFeatures::GetForcedKernel() == Forced);
+	BOOST_CHECK(ExpectedHashOfDefaultData == Portable->ComputeString(DefaultData)->ToString());
+
+	// a forced kernel whose features are withdrawn is skipped
+	uint32_t Disabled = CpuFeatures::GetDisabled();
+	CpuFeatures::SetDisabled(CpuFeatures::ParseNames("all"));
+	CpuFeatures::SetForcedKernel("SHA-NI");
+	IHash Withdrawn = HashLib4CPP::Crypto::CreateSHA2_256();
+	CpuFeatures::SetForcedKernel(Forced);
+	CpuFeatures::SetDisabled(Disabled);
+
+	BOOST_CHECK(Withdrawn->GetKernelName() == "Portable");
+}
+
+BOOST_AUTO_TEST_CASE(TestSelectedKernelsMatchPortable)
+{
+	IHash (*Factories[])() = { HashLib4CPP::Crypto::CreateSHA1,
+		HashLib4CPP::Crypto::CreateSHA2_224, HashLib4CPP::Crypto::CreateSHA2_256,
+		HashLib4CPP::Crypto::CreateSHA2_384, HashLib4CPP::Crypto::CreateSHA2_512,
+		HashLib4CPP::Crypto::CreateSHA2_512_224, HashLib4CPP::Crypto::CreateSHA2_512_256 };
+	// without "sha" the SHA-256 family falls back to its AVX2 kernel
+	const char *Withdrawn[] = { "", "sha" };
+	HashLibByteArray Data(300);
+
+	for (size_t i = 0; i < Data.size(); i++)
+		Data[i] = uint8_t(i * 7 + 3);
+
+	for (const char *Names : Withdrawn)
+	for (IHash (*Factory)() : Factories)
+	{
+		uint32_t Disabled = CpuFeatures::GetDisabled();
+		CpuFeatures::SetDisabled(Disabled | CpuFeatures::ParseNames(Names));
+		IHash Selected = Factory();
+		CpuFeatures::SetDisabled(CpuFeatures::ParseNames("all"));
+		IHash Portable = Factory();
+		CpuFeatures::SetDisabled(Disabled);
+
+		for (size_t Length = 0; Length <= Data.size(); Length += 13)
+		{
+			// whole blocks at once, then through the buffer a few bytes at a time
+			BOOST_CHECK(Portable->ComputeUntyped(&Data[0], Length)->ToString()
+				== Selected->ComputeUntyped(&Data[0], Length)->ToString());
+
+			Selected->Initialize();
+			for (size_t j = 0; j < Length; j += 5)
+				Selected->TransformBytes(&Data[j], min<int64_t>(5, Length - j));
+			BOOST_CHECK(Portable->ComputeUntyped(&Data[0], Length)->ToString()
+				== Selected->TransformFinal()->ToString());
+		} // end for
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(TestSHA2_256MultiBufferMatchesSerial)
+{
+	// lane counts differ per kernel, so walk every one this host can run
+	const char *Withdrawn[] = { "", "sha", "sha,avx512", "sha,avx512,avx2", "all" };
+	HashLibByteArray Data(1000);
+	HashLibSpanArray Messages;
+
+	for (size_t i = 0; i < Data.size(); i++)
+		Data[i] = uint8_t(i * 7 + 3);
+
+	// lengths on both sides of the one and two padding block cases
+	for (size_t i = 0; i < 150; i++)
+	{
+		HashLibSpan Message = { &Data[i], int64_t((i * 37) % 700) };
+		Messages.push_back(Message);
+	} // end for
+
+	uint32_t Disabled = CpuFeatures::GetDisabled();
+	for (const char *Names : Withdrawn)
+	{
+		CpuFeatures::SetDisabled(Disabled | CpuFeatures::ParseNames(Names));
+		HashLibHashResultArray Results224 = HashLib4CPP::Batch::ComputeSHA2_224(Messages);
+		HashLibHashResultArray Results256 = HashLib4CPP::Batch::ComputeSHA2_256(Messages);
+		CpuFeatures::SetDisabled(Disabled);
+
+		for (size_t i = 0; i < Messages.size(); i++)
+		{
+			BOOST_CHECK(Results224[i]->ToString() == HashLib4CPP::Crypto::CreateSHA2_224()
+				->ComputeUntyped(Messages[i].data, Messages[i].length)->ToString());
+			BOOST_CHECK(Results256[i]->ToString() == HashLib4CPP::Crypto::CreateSHA2_256()
+				->ComputeUntyped(Messages[i].data, Messages[i].length)->ToString());
+		} // end for
+	} // end for
+
+	BOOST_CHECK(HashLib4CPP::Batch::ComputeSHA2_256(HashLibSpanArray()).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -3926,6 +4259,26 @@ BOOST_AUTO_TEST_CASE(TestHMACCloneIsCorrect)
 	HMACCloneIsCorrect(hash);
 }
 
+BOOST_AUTO_TEST_CASE(TestPooledHashSettingsAreReset)
+{
+	int32_t DefaultBufferSize, DefaultReadAheadDepth;
+	FileReadMode DefaultFileReadMode;
+	{
+		PooledHash<IHash> tuned = HashLib4CPP::Pool::Acquire(HashLib4CPP::Crypto::CreateSHA2_512);
+		DefaultBufferSize = tuned->GetBufferSize();
+		DefaultReadAheadDepth = tuned->GetReadAheadDepth();
+		DefaultFileReadMode = tuned->GetFileReadMode();
+		tuned->SetBufferSize(DefaultBufferSize * 2);
+		tuned->SetReadAheadDepth(DefaultReadAheadDepth + 4);
+		tuned->SetFileReadMode(FileReadMapped);
+	}
+
+	PooledHash<IHash> tuned = HashLib4CPP::Pool::Acquire(HashLib4CPP::Crypto::CreateSHA2_512);
+	BOOST_CHECK(DefaultBufferSize == tuned->GetBufferSize());
+	BOOST_CHECK(DefaultReadAheadDepth == tuned->GetReadAheadDepth());
+	BOOST_CHECK(DefaultFileReadMode == tuned->GetFileReadMode());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -6779,6 +7132,19 @@ BOOST_AUTO_TEST_CASE(TestHMACCloneIsCorrect)
 	HMACCloneIsCorrect(hash);
 }
 
+BOOST_AUTO_TEST_CASE(TestStaticCopyIsIndependent)
+{
+	string ExpectedBlakeOfDefaultData = HashLib4CPP::Crypto::CreateBlake2B()->ComputeString(DefaultData)->ToString();
+	string ExpectedBlakeOfOnetoNine = HashLib4CPP::Crypto::CreateBlake2B()->ComputeString(DefaultData.substr(0, 10) + OnetoNine)->ToString();
+	HashLib4CPP::Static::Blake2B blake;
+	blake.Update(DefaultData.data(), 10);
+	HashLib4CPP::Static::Blake2B BlakeCopy = blake;
+	BlakeCopy.Update(OnetoNine.data(), int64_t(OnetoNine.size()));
+	blake.Update(DefaultData.data() + 10, int64_t(DefaultData.size()) - 10);
+	BOOST_CHECK(ExpectedBlakeOfDefaultData == blake.FinalValue().ToString());
+	BOOST_CHECK(ExpectedBlakeOfOnetoNine == BlakeCopy.FinalValue().ToString());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -6986,4 +7352,691 @@ BOOST_AUTO_TEST_CASE(TestHMACCloneIsCorrect)
 	HMACCloneIsCorrect(hash);
 }
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_SUITE_END()
+
+
+// ====================== FileIOTestCase ======================
+////////////////////
+// File and stream input/output
+///////////////////
+BOOST_AUTO_TEST_SUITE(FileIOTestCase)
+
+BOOST_AUTO_TEST_CASE(TestMappedFileMatchesStream)
+{
+	IHash hash = HashLib4CPP::Crypto::CreateSHA2_256();
+	string FileName = "MappedFileTest.txt", Data = "";
+
+	for (int32_t i = 0; i < 10000; i++)
+		Data = Data + DefaultData;
+
+	ofstream output(FileName, ios::out | ios::binary);
+	output.write(Data.data(), Data.size());
+	output.close();
+
+	string ExpectedString = hash->ComputeString(Data)->ToString();
+	string ExpectedRangeString = hash->ComputeString(Data.substr(7, 5000))->ToString();
+
+	hash->SetFileReadMode(FileReadMapped);
+	string ActualString = hash->ComputeFile(FileName)->ToString();
+	string ActualRangeString = hash->ComputeFile(FileName, 7, 5000)->ToString();
+
+	hash->SetFileReadMode(FileReadStream);
+	string StreamString = hash->ComputeFile(FileName)->ToString();
+
+	remove(FileName.c_str());
+
+	BOOST_CHECK(ExpectedString == ActualString);
+	BOOST_CHECK(ExpectedRangeString == ActualRangeString);
+	BOOST_CHECK(ExpectedString == StreamString);
+}
+
+BOOST_AUTO_TEST_CASE(TestReadAheadStreamMatchesPlainStream)
+{
+	IHash hash = HashLib4CPP::Crypto::CreateSHA2_256();
+	string FileName = "ReadAheadTest.txt", Data = "";
+
+	for (int32_t i = 0; i < 10000; i++)
+		Data = Data + DefaultData;
+
+	ofstream output(FileName, ios::out | ios::binary);
+	output.write(Data.data(), Data.size());
+	output.close();
+
+	string ExpectedString = hash->ComputeString(Data)->ToString();
+	string ExpectedRangeString = hash->ComputeString(Data.substr(7, 50000))->ToString();
+
+	hash->SetBufferSize(1000);
+	hash->SetReadAheadDepth(4);
+	string ActualString = hash->ComputeFile(FileName)->ToString();
+	string ActualRangeString = hash->ComputeFile(FileName, 7, 50000)->ToString();
+
+	hash->SetReadAheadDepth(0);
+	string PlainString = hash->ComputeFile(FileName)->ToString();
+
+	remove(FileName.c_str());
+
+	BOOST_CHECK(ExpectedString == ActualString);
+	BOOST_CHECK(ExpectedRangeString == ActualRangeString);
+	BOOST_CHECK(ExpectedString == PlainString);
+}
+
+BOOST_AUTO_TEST_CASE(TestDirectFileMatchesStream)
+{
+	IHash hash = HashLib4CPP::Crypto::CreateSHA2_256();
+	string FileName = "DirectFileTest.txt", Data = "";
+
+	for (int32_t i = 0; i < 100000; i++)
+		Data = Data + DefaultData;
+
+	ofstream output(FileName, ios::out | ios::binary);
+	output.write(Data.data(), Data.size());
+	output.close();
+
+	string ExpectedString = hash->ComputeString(Data)->ToString();
+	string ExpectedRangeString = hash->ComputeString(Data.substr(4097, 1000000))->ToString();
+	string ExpectedSpanString = hash->ComputeString(Data.substr(4097, Data.size() - 5000))->ToString();
+
+	hash->SetFileReadMode(FileReadDirect);
+	string ActualString = hash->ComputeFile(FileName)->ToString();
+	string ActualRangeString = hash->ComputeFile(FileName, 4097, 1000000)->ToString();
+
+	// the file spans two direct chunks, read by concurrent readers
+	hash->SetReadAheadDepth(8);
+	string ConcurrentString = hash->ComputeFile(FileName)->ToString();
+	string ConcurrentRangeString = hash->ComputeFile(FileName, 4097, Data.size() - 5000)->ToString();
+
+	remove(FileName.c_str());
+
+	BOOST_CHECK(ExpectedString == ActualString);
+	BOOST_CHECK(ExpectedRangeString == ActualRangeString);
+	BOOST_CHECK(ExpectedString == ConcurrentString);
+	BOOST_CHECK(ExpectedSpanString == ConcurrentRangeString);
+}
+
+BOOST_AUTO_TEST_CASE(TestBatchComputeFiles)
+{
+	IHash hash = HashLib4CPP::Crypto::CreateSHA2_256();
+	HashLibStringArray FileNames;
+	HashLibHashResultArray Results;
+	string Data = "";
+
+	// empty, small, a few read sizes and one too large to buffer in memory
+	int32_t Repeats[] = { 0, 1, 4681, 4682, 100000, 400000 };
+
+	for (int32_t i = 0; i < 6; i++)
+	{
+		Data.clear();
+		for (int32_t j = 0; j < Repeats[i]; j++)
+			Data += DefaultData;
+
+		FileNames.push_back(Utils::string_format("BatchFileTest%d.txt", i));
+		ofstream output(FileNames.back(), ios::out | ios::binary);
+		output.write(Data.data(), Data.size());
+		output.close();
+	}
+	FileNames.push_back("BatchFileTestMissing.txt");
+
+	Results = HashLib4CPP::Batch::ComputeFiles(hash, FileNames, 2);
+
+	BOOST_CHECK(Results.size() == FileNames.size());
+	for (size_t i = 0; i + 1 < FileNames.size(); i++)
+	{
+		BOOST_CHECK(Results[i] && Results[i]->ToString() == hash->ComputeFile(FileNames[i])->ToString());
+		remove(FileNames[i].c_str());
+	}
+	BOOST_CHECK(!Results.back());
+
+#ifdef __linux__
+	// procfs reports a size of zero for files that are not empty
+	ifstream input("/proc/version", ios::in | ios::binary);
+	string Version((istreambuf_iterator<char>(input)), istreambuf_iterator<char>());
+
+	Results = HashLib4CPP::Batch::ComputeFiles(hash, HashLibStringArray(1, "/proc/version"));
+	BOOST_CHECK(!Version.empty() && Results[0] && Results[0]->ToString() == hash->ComputeString(Version)->ToString());
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(TestNonSeekableStream)
+{
+	IHash hash = HashLib4CPP::Crypto::CreateSHA2_256();
+	string Data = "";
+
+	for (int32_t i = 0; i < 10000; i++)
+		Data += DefaultData;
+
+	string ExpectedString = hash->ComputeString(Data)->ToString();
+	string ExpectedPrefixString = hash->ComputeString(Data.substr(0, 1000))->ToString();
+
+	istringstream stream(Data);
+	string ActualString = hash->ComputeStream(stream)->ToString();
+
+	stringbuf buffer(Data);
+	string ActualPrefixString = hash->ComputeStream(buffer, 1000)->ToString();
+
+	BOOST_CHECK(ExpectedString == ActualString);
+	BOOST_CHECK(ExpectedPrefixString == ActualPrefixString);
+
+#ifdef HASHLIB_POSIX_IO
+	int handles[2];
+
+	BOOST_CHECK(pipe(handles) == 0);
+	BOOST_CHECK(write(handles[1], Data.data(), 1000) == 1000);
+	close(handles[1]);
+
+	string ActualPipeString = hash->ComputeDescriptor(handles[0])->ToString();
+	close(handles[0]);
+
+	BOOST_CHECK(ExpectedPrefixString == ActualPipeString);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(TestHashingOStream)
+{
+	HashLibHashArray hashes;
+	string Data = "";
+
+	hashes.push_back(HashLib4CPP::Crypto::CreateSHA2_256());
+	hashes.push_back(HashLib4CPP::Hash64::CreateXXHash64());
+
+	for (int32_t i = 0; i < 10000; i++)
+		Data += DefaultData;
+
+	string ExpectedString = HashLib4CPP::Crypto::CreateSHA2_256()->ComputeString(Data)->ToString();
+	string ExpectedXXHashString = HashLib4CPP::Hash64::CreateXXHash64()->ComputeString(Data)->ToString();
+
+	ostringstream sink;
+	HashingOStream stream(hashes, sink.rdbuf());
+
+	// a mix of small buffered writes and one larger than the buffer
+	stream << Data.substr(0, 10);
+	stream.put(Data[10]);
+	stream.write(Data.data() + 11, 100000);
+	stream << Data.substr(100011);
+
+	HashLibHashResultArray Results = stream.TransformFinalAll();
+
+	BOOST_CHECK(sink.str() == Data);
+	BOOST_CHECK(ExpectedString == Results[0]->ToString());
+	BOOST_CHECK(ExpectedXXHashString == Results[1]->ToString());
+}
+
+// takes bytes up to its limit and refuses everything after
+struct LimitedSink : public streambuf
+{
+	string data;
+	size_t limit;
+
+	LimitedSink()
+		: limit(0)
+	{}
+
+	virtual streamsize xsputn(const char *a_data, streamsize a_length)
+	{
+		streamsize LTaken = min<streamsize>(a_length, streamsize(limit - data.size()));
+		data.append(a_data, size_t(LTaken));
+		return LTaken;
+	}
+};
+
+BOOST_AUTO_TEST_CASE(TestHashingOStreamRejectedBytes)
+{
+	LimitedSink sink;
+
+	IHash hash = HashLib4CPP::Crypto::CreateSHA2_256();
+	string Data = "";
+
+	for (int32_t i = 0; i < 10; i++)
+		Data += DefaultData;
+
+	string ExpectedString = HashLib4CPP::Crypto::CreateSHA2_256()->ComputeString(Data.substr(0, 120))->ToString();
+
+	HashingOStream stream(hash, &sink);
+
+	sink.limit = 100;
+	stream.write(Data.data(), 60);
+	stream.write(Data.data() + 60, 60);
+	stream.flush();
+
+	BOOST_CHECK(stream.bad());
+	BOOST_CHECK(sink.data == Data.substr(0, 100));
+
+	// the refused bytes were kept and go out once the sink takes them
+	sink.limit = 1000;
+	stream.clear();
+	stream.flush();
+
+	BOOST_CHECK(stream.good());
+
+	string ActualString = stream.TransformFinal()->ToString();
+
+	BOOST_CHECK(sink.data == Data.substr(0, 120));
+	BOOST_CHECK(ExpectedString == ActualString);
+}
+
+BOOST_AUTO_TEST_CASE(TestHashingOStreamRefusedBytesStayInMessage)
+{
+	LimitedSink sink;
+
+	IHash hash = HashLib4CPP::Crypto::CreateSHA2_256();
+	string Data = "";
+
+	for (int32_t i = 0; i < 10; i++)
+		Data += DefaultData;
+
+	string ExpectedString = hash->ComputeString(Data.substr(0, 120))->ToString();
+	string ExpectedNextString = hash->ComputeString(DefaultData)->ToString();
+
+	HashingOStream stream(hash, &sink);
+
+	sink.limit = 100;
+	stream.write(Data.data(), 120);
+
+	// no digest while bytes of the message are still pending
+	BOOST_CHECK_THROW(stream.TransformFinal(), InvalidOperationHashLibException);
+
+	sink.limit = 1000;
+	stream.clear();
+
+	BOOST_CHECK(ExpectedString == stream.TransformFinal()->ToString());
+
+	stream << DefaultData;
+
+	BOOST_CHECK(ExpectedNextString == stream.TransformFinal()->ToString());
+	BOOST_CHECK(sink.data == Data.substr(0, 120) + DefaultData);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+// ====================== MemoryResourceTestCase ======================
+////////////////////
+// Memory resources
+///////////////////
+BOOST_AUTO_TEST_SUITE(MemoryResourceTestCase)
+
+string ExpectedHashOfDefaultData = "BCF45544CB98DDAB731927F8760F81821489ED04C0792A4D254134887BEA9E38";
+
+class CountingMemoryResource : public NewDeleteMemoryResource
+{
+public:
+	CountingMemoryResource()
+		: count(0)
+	{}
+
+	int32_t count;
+
+protected:
+	virtual void * DoAllocate(const size_t a_bytes, const size_t a_alignment)
+	{
+		count++;
+		return NewDeleteMemoryResource::DoAllocate(a_bytes, a_alignment);
+	}
+};
+
+BOOST_AUTO_TEST_CASE(TestResultInArenaMatchesTransformFinal)
+{
+	uint8_t Buffer[1024];
+	CountingMemoryResource Upstream;
+	IHash hash = HashLib4CPP::Crypto::CreateSHA2_256();
+
+	{
+		MonotonicMemoryResource Arena(Buffer, sizeof(Buffer), Upstream);
+
+		for (int32_t i = 0; i < 4; i++)
+		{
+			IHashResult Result = hash->ComputeUntypedIn(DefaultData.data(), int64_t(DefaultData.size()), Arena);
+
+			BOOST_CHECK(ExpectedHashOfDefaultData == Result->ToString());
+		} // end for
+
+		// four results fit in the caller buffer
+		BOOST_CHECK(Upstream.count == 0);
+
+		for (int32_t i = 0; i < 64; i++)
+			hash->ComputeUntypedIn(DefaultData.data(), int64_t(DefaultData.size()), Arena);
+
+		BOOST_CHECK(Upstream.count > 0);
+
+		Arena.Release();
+		IHashResult Result = hash->ComputeUntypedIn(DefaultData.data(), int64_t(DefaultData.size()), Arena);
+		BOOST_CHECK(ExpectedHashOfDefaultData == Result->ToString());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(TestNewDeleteResourceAlignmentAndCompare)
+{
+	MemoryResource &Resource = MemoryResource::GetDefault();
+	size_t Alignments[] = { 1, alignof(max_align_t), 64, 4096 };
+
+	for (size_t i = 0; i < 4; i++)
+	{
+		void *Ptr = Resource.Allocate(100, Alignments[i]);
+		BOOST_CHECK(uintptr_t(Ptr) % Alignments[i] == 0);
+		memset(Ptr, 0xA5, 100);
+		Resource.Deallocate(Ptr, 100, Alignments[i]);
+	} // end for
+
+	BOOST_CHECK_THROW(Resource.Allocate(100, 96), ArgumentHashLibException);
+
+	IHash hash = HashLib4CPP::Crypto::CreateSHA2_256();
+	uint8_t Buffer[256];
+	MonotonicMemoryResource Arena(Buffer, sizeof(Buffer));
+
+	IHashResult Result = hash->ComputeString(DefaultData);
+	IHashResult ArenaResult = hash->ComputeUntypedIn(DefaultData.data(), int64_t(DefaultData.size()), Arena);
+	IHashResult OtherResult = hash->ComputeString(EmptyData);
+
+	BOOST_CHECK(Result->CompareTo(ArenaResult));
+	BOOST_CHECK(ArenaResult->CompareTo(Result));
+	BOOST_CHECK(!Result->CompareTo(OtherResult));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+// ====================== HashApiTestCase ======================
+////////////////////
+// Hash API shared by every family
+///////////////////
+BOOST_AUTO_TEST_SUITE(HashApiTestCase)
+
+// one hash for each path the API is implemented on: the one-shot and
+// direct digest writers, a truncated digest, the generic block hashes, the
+// sponge and Blake2 buffers, keyed 32 and 64-bit hashes, a checksum and a
+// CRC whose digest is narrower than its register
+HashLibHashArray CreateHashes()
+{
+	HashLibHashArray hashes;
+
+	hashes.push_back(HashLib4CPP::Crypto::CreateSHA2_256());
+	hashes.push_back(HashLib4CPP::Crypto::CreateSHA2_384());
+	hashes.push_back(HashLib4CPP::Crypto::CreateSHA2_512_224());
+	hashes.push_back(HashLib4CPP::Crypto::CreateSHA1());
+	hashes.push_back(HashLib4CPP::Crypto::CreateMD5());
+	hashes.push_back(HashLib4CPP::Crypto::CreateRIPEMD160());
+	hashes.push_back(HashLib4CPP::Crypto::CreateTiger_3_192());
+	hashes.push_back(HashLib4CPP::Crypto::CreateHaval_5_256());
+	hashes.push_back(HashLib4CPP::Crypto::CreateSHA3_256());
+	hashes.push_back(HashLib4CPP::Crypto::CreateBlake2B());
+	hashes.push_back(HashLib4CPP::Crypto::CreatePanama());
+	hashes.push_back(HashLib4CPP::Hash32::CreateXXHash32());
+	hashes.push_back(HashLib4CPP::Hash64::CreateXXHash64());
+	hashes.push_back(HashLib4CPP::Checksum::CreateCRC32_PKZIP());
+	hashes.push_back(HashLib4CPP::Checksum::CreateCRC(CRC17_CANFD));
+
+	return hashes;
+} // end function CreateHashes
+
+BOOST_AUTO_TEST_CASE(TestComputeIntoMatchesCompute)
+{
+	HashLibHashArray hashes = CreateHashes();
+	string Data = "";
+
+	for (int32_t i = 0; i < 100; i++)
+		Data += DefaultData;
+
+	for (size_t i = 0; i < hashes.size(); i++)
+	{
+		HashLibByteArray Expected = hashes[i]->ComputeString(Data)->GetBytes();
+		HashLibByteArray Actual = HashLibByteArray(Expected.size());
+		bool Thrown = false;
+
+		hashes[i]->ComputeInto(Data.data(), int64_t(Data.size()), &Actual[0], Actual.size());
+		BOOST_CHECK(Expected == Actual);
+
+		hashes[i]->Initialize();
+		hashes[i]->TransformString(Data);
+		hashes[i]->TransformFinalInto(&Actual[0], Actual.size());
+		BOOST_CHECK(Expected == Actual);
+
+		try
+		{
+			hashes[i]->ComputeInto(Data.data(), int64_t(Data.size()), &Actual[0], Actual.size() - 1);
+		}
+		catch (ArgumentOutOfRangeHashLibException &)
+		{
+			Thrown = true;
+		}
+
+		BOOST_CHECK(Thrown);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(TestHashValueMatchesHashResult)
+{
+	HashLibHashArray hashes = CreateHashes();
+	string Data = "";
+
+	for (int32_t i = 0; i < 100; i++)
+		Data += DefaultData;
+
+	for (size_t i = 0; i < hashes.size(); i++)
+	{
+		IHashResult Expected = hashes[i]->ComputeString(Data);
+		HashValue Actual = hashes[i]->ComputeValue(Data.data(), int64_t(Data.size()));
+		HashValue Copy = Actual;
+
+		BOOST_CHECK(Expected->GetBytes() == Actual.GetBytes());
+		BOOST_CHECK(Expected->ToString() == Actual.ToString());
+		BOOST_CHECK(Copy.GetHashCode() == Actual.GetHashCode());
+		BOOST_CHECK(HashValue(Expected) == Actual);
+		BOOST_CHECK(Copy.CompareTo(Actual));
+		BOOST_CHECK(Copy != HashValue());
+
+		if (hashes[i]->GetHashSize() == 4)
+			BOOST_CHECK(Expected->GetUInt32() == Actual.GetUInt32());
+		else if (hashes[i]->GetHashSize() == 8)
+			BOOST_CHECK(Expected->GetUInt64() == Actual.GetUInt64());
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(TestOneShotMatchesIncremental)
+{
+	HashLibHashArray hashes = CreateHashes();
+	string Data = "";
+
+	while (Data.size() < 300)
+		Data += DefaultData;
+
+	// every length around the one and two block padding boundaries
+	for (size_t i = 0; i < hashes.size(); i++)
+	{
+		for (size_t length = 0; length <= 300; length++)
+		{
+			string Message = Data.substr(0, length);
+
+			hashes[i]->Initialize();
+			hashes[i]->TransformString(Message.substr(0, length / 2));
+			hashes[i]->TransformString(Message.substr(length / 2));
+			string ExpectedString = hashes[i]->TransformFinal()->ToString();
+
+			BOOST_CHECK(ExpectedString == hashes[i]->ComputeString(Message)->ToString());
+			BOOST_CHECK(ExpectedString == hashes[i]->ComputeValue(Message.data(), int64_t(length)).ToString());
+		} // end for
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(TestOneShotInvalidInputIsEmpty)
+{
+	HashLibHashArray hashes = CreateHashes();
+	uint8_t Data[64] = { 0 };
+	HashLibByteArray Actual;
+
+	// the hashes that need the whole message at once
+	hashes.push_back(HashLib4CPP::Hash32::CreateDEK());
+	hashes.push_back(HashLib4CPP::Hash32::CreateSuperFast());
+	hashes.push_back(HashLib4CPP::Hash32::CreateJenkins3());
+	hashes.push_back(HashLib4CPP::Hash32::CreateMurmur2());
+	hashes.push_back(HashLib4CPP::Hash64::CreateMurmur2());
+
+	for (size_t i = 0; i < hashes.size(); i++)
+	{
+		string ExpectedString = hashes[i]->ComputeString("")->ToString();
+
+		Actual.resize(hashes[i]->GetHashSize());
+
+		// a negative length, and a positive one without data
+		for (const uint8_t *Ptr : { (const uint8_t *)Data, (const uint8_t *)nullptr })
+		{
+			int64_t Length = Ptr ? -5 : 5;
+
+			BOOST_CHECK(ExpectedString == hashes[i]->ComputeUntyped(Ptr, Length)->ToString());
+			BOOST_CHECK(ExpectedString == hashes[i]->ComputeValue(Ptr, Length).ToString());
+
+			hashes[i]->ComputeInto(Ptr, Length, &Actual[0], Actual.size());
+			BOOST_CHECK(ExpectedString == Converters::ConvertBytesToHexString(Actual, false));
+
+			hashes[i]->Initialize();
+			hashes[i]->TransformUntyped(Ptr, Length);
+			BOOST_CHECK(ExpectedString == hashes[i]->TransformFinal()->ToString());
+		} // end for
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(TestCopyStateFromRestoresMidstate)
+{
+	HashLibHashArray hashes = CreateHashes(), midstates = CreateHashes();
+	string Prefix = "", Suffix = "Suffix";
+
+	IHMAC hmac = HashLib4CPP::HMAC::CreateHMAC(HashLib4CPP::Crypto::CreateSHA2_256());
+	hmac->SetKey(Converters::ConvertStringToBytes(HMACLongStringKey));
+	hashes.push_back(hmac);
+	midstates.push_back(hmac->Clone());
+
+	while (Prefix.size() < 200)
+		Prefix += DefaultData;
+
+	for (size_t i = 0; i < hashes.size(); i++)
+	{
+		string ExpectedString = hashes[i]->ComputeString(Prefix + Suffix)->ToString();
+
+		hashes[i]->Initialize();
+		hashes[i]->TransformString(Prefix);
+		midstates[i]->Initialize();
+		midstates[i]->CopyStateFrom(*hashes[i]);
+
+		// the same midstate must be reusable for several messages
+		for (int32_t round = 0; round < 2; round++)
+		{
+			hashes[i]->Initialize();
+			hashes[i]->TransformString(DefaultData);
+			hashes[i]->CopyStateFrom(*midstates[i]);
+			hashes[i]->TransformString(Suffix);
+
+			BOOST_CHECK(ExpectedString == hashes[i]->TransformFinal()->ToString());
+		} // end for
+	} // end for
+
+	BOOST_CHECK_THROW(hashes[0]->CopyStateFrom(*hashes[1]), ArgumentHashLibException);
+}
+
+BOOST_AUTO_TEST_CASE(TestCopyStateFromKeepsConfiguration)
+{
+	HashLibHashArray sources, targets;
+	string Forced = CpuFeatures::GetForcedKernel();
+
+	sources.push_back(HashLib4CPP::Crypto::CreateSHA2_256());
+	sources.push_back(HashLib4CPP::Crypto::CreateSHA1());
+	sources.push_back(HashLib4CPP::Crypto::CreateSHA3_256());
+	sources.push_back(HashLib4CPP::Crypto::CreateTiger2_3_192());
+	sources.push_back(HashLib4CPP::Hash32::CreateXXHash32());
+
+	CpuFeatures::SetForcedKernel("Portable");
+	targets.push_back(HashLib4CPP::Crypto::CreateSHA2_256());
+	targets.push_back(HashLib4CPP::Crypto::CreateSHA1());
+	CpuFeatures::SetForcedKernel(Forced);
+	targets.push_back(HashLib4CPP::Crypto::CreateSHA3_256());
+	targets.push_back(HashLib4CPP::Crypto::CreateTiger2_3_192());
+	targets.push_back(HashLib4CPP::Hash32::CreateXXHash32());
+
+	for (size_t i = 0; i < sources.size(); i++)
+	{
+		string ExpectedString = sources[i]->ComputeString(DefaultData)->ToString();
+		int32_t BufferSize = targets[i]->GetBufferSize();
+		int32_t ReadAheadDepth = targets[i]->GetReadAheadDepth();
+		FileReadMode Mode = targets[i]->GetFileReadMode();
+		string KernelName = targets[i]->GetKernelName();
+
+		sources[i]->SetBufferSize(12345);
+		sources[i]->SetReadAheadDepth(ReadAheadDepth + 3);
+		sources[i]->SetFileReadMode(Mode == FileReadMapped ? FileReadStream : FileReadMapped);
+
+		sources[i]->Initialize();
+		sources[i]->TransformString(DefaultData.substr(0, 5));
+		targets[i]->Initialize();
+		targets[i]->CopyStateFrom(*sources[i]);
+
+		// only the midstate moves, the target keeps its own settings
+		BOOST_CHECK(BufferSize == targets[i]->GetBufferSize());
+		BOOST_CHECK(ReadAheadDepth == targets[i]->GetReadAheadDepth());
+		BOOST_CHECK(Mode == targets[i]->GetFileReadMode());
+		BOOST_CHECK(KernelName == targets[i]->GetKernelName());
+
+		targets[i]->TransformString(DefaultData.substr(5));
+		BOOST_CHECK(ExpectedString == targets[i]->TransformFinal()->ToString());
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(TestSaveStateResumesInNewInstance)
+{
+	HashLibHashArray sources = CreateHashes(), targets = CreateHashes();
+	string Prefix = "", Suffix = "Suffix";
+
+	while (Prefix.size() < 201)
+		Prefix += DefaultData;
+
+	for (size_t i = 0; i < sources.size(); i++)
+	{
+		string ExpectedString = sources[i]->ComputeString(Prefix + Suffix)->ToString();
+
+		sources[i]->Initialize();
+		sources[i]->TransformString(Prefix);
+		HashLibByteArray State = sources[i]->SaveState();
+
+		targets[i]->Initialize();
+		targets[i]->RestoreState(State);
+		targets[i]->TransformString(Suffix);
+
+		BOOST_CHECK(ExpectedString == targets[i]->TransformFinal()->ToString());
+
+		State.pop_back();
+		BOOST_CHECK_THROW(targets[i]->RestoreState(State), ArgumentHashLibException);
+	} // end for
+
+	BOOST_CHECK_THROW(targets[1]->RestoreState(sources[0]->SaveState()), ArgumentHashLibException);
+}
+
+BOOST_AUTO_TEST_CASE(TestRestoreStateWithoutInitialize)
+{
+	HashLibHashArray sources = CreateHashes(), targets = CreateHashes();
+	string Prefix = "", Suffix = "Suffix";
+
+	while (Prefix.size() < 201)
+		Prefix += DefaultData;
+
+	// table driven CRCs of each width and family
+	sources.push_back(HashLib4CPP::Checksum::CreateCRC16_BUYPASS());
+	sources.push_back(HashLib4CPP::Checksum::CreateCRC32_CASTAGNOLI());
+	sources.push_back(HashLib4CPP::Checksum::CreateCRC64_ECMA());
+	sources.push_back(HashLib4CPP::Checksum::CreateCRC(CRC32));
+	targets.push_back(HashLib4CPP::Checksum::CreateCRC16_BUYPASS());
+	targets.push_back(HashLib4CPP::Checksum::CreateCRC32_CASTAGNOLI());
+	targets.push_back(HashLib4CPP::Checksum::CreateCRC64_ECMA());
+	targets.push_back(HashLib4CPP::Checksum::CreateCRC(CRC32));
+
+	for (size_t i = 0; i < sources.size(); i++)
+	{
+		string ExpectedString = sources[i]->ComputeString(Prefix + Suffix)->ToString();
+
+		sources[i]->Initialize();
+		sources[i]->TransformString(Prefix);
+
+		// the target was never initialized, as in a resuming process
+		targets[i]->RestoreState(sources[i]->SaveState());
+		targets[i]->TransformString(Suffix);
+
+		BOOST_CHECK(ExpectedString == targets[i]->TransformFinal()->ToString());
+	} // end for
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -681,6 +681,11 @@ BOOST_AUTO_TEST_CASE(TestHashCloneIsUnique)
 		Utils::string_format("Expected %d but got %d.", Original->GetBufferSize(), Copy->GetBufferSize()));
 }
 
+BOOST_AUTO_TEST_CASE(TestConstexprMatchesRuntime)
+{
+	ConstexprMatchesRuntime<uint32_t>(HashLib4CPP::Constexpr::DJB, djb);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -903,6 +908,11 @@ BOOST_AUTO_TEST_CASE(TestHashCloneIsUnique)
 		Utils::string_format("Expected %d but got %d.", Original->GetBufferSize(), Copy->GetBufferSize()));
 }
 
+BOOST_AUTO_TEST_CASE(TestConstexprMatchesRuntime)
+{
+	ConstexprMatchesRuntime<uint32_t>(HashLib4CPP::Constexpr::FNV, fnv);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -1014,6 +1024,20 @@ BOOST_AUTO_TEST_CASE(TestHashCloneIsUnique)
 		Utils::string_format("Expected %d but got %d.", Original->GetBufferSize(), Copy->GetBufferSize()));
 }
 
+BOOST_AUTO_TEST_CASE(TestConstexprMatchesRuntime)
+{
+	// usable where a constant expression is required
+	switch (fnv1a->ComputeString(DefaultData)->GetUInt32())
+	{
+	case HashLib4CPP::Constexpr::FNV1a("HashLib4Pascal"):
+		break;
+	default:
+		BOOST_FAIL("FNV1a case label does not match the runtime hash");
+	} // end switch
+
+	ConstexprMatchesRuntime<uint32_t>(HashLib4CPP::Constexpr::FNV1a, fnv1a);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -1556,6 +1580,11 @@ BOOST_AUTO_TEST_CASE(TestHashCloneIsUnique)
 		Utils::string_format("Expected %d but got %d.", Original->GetBufferSize(), Copy->GetBufferSize()));
 }
 
+BOOST_AUTO_TEST_CASE(TestConstexprMatchesRuntime)
+{
+	ConstexprMatchesRuntime<uint32_t>(HashLib4CPP::Constexpr::MurmurHash3_x86_32, murmurhash3_x86_32);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -2111,6 +2140,11 @@ BOOST_AUTO_TEST_CASE(TestHashCloneIsUnique)
 		Utils::string_format("Expected %d but got %d.", Original->GetBufferSize(), Copy->GetBufferSize()));
 }
 
+BOOST_AUTO_TEST_CASE(TestConstexprMatchesRuntime)
+{
+	ConstexprMatchesRuntime<uint32_t>(HashLib4CPP::Constexpr::SDBM, sdbm);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -2386,6 +2420,30 @@ BOOST_AUTO_TEST_CASE(TestIncrementalHash)
 	BOOST_CHECK(ExpectedHashOfDefaultData == ActualString);
 }
 
+BOOST_AUTO_TEST_CASE(TestPointerTransformBytes)
+{
+	IHash hash = HashLib4CPP::Hash32::CreateXXHash32();
+	string Padded = "xyz" + DefaultData + "xyz";
+
+	hash->Initialize();
+	hash->TransformBytes((const uint8_t *)Padded.data(), 0);
+	string EmptyString = hash->TransformFinal()->ToString();
+
+	hash->Initialize();
+	hash->TransformBytes((const uint8_t *)Padded.data() + 3, (int64_t)DefaultData.size());
+	string OffsetString = hash->TransformFinal()->ToString();
+
+	hash->Initialize();
+	hash->TransformBytes((const uint8_t *)Padded.data() + 3, 5);
+	hash->TransformBytes((const uint8_t *)Padded.data() + 8, 0);
+	hash->TransformBytes((const uint8_t *)Padded.data() + 8, (int64_t)DefaultData.size() - 5);
+	string SplitString = hash->TransformFinal()->ToString();
+
+	BOOST_CHECK(ExpectedHashOfEmptyData == EmptyString);
+	BOOST_CHECK(ExpectedHashOfDefaultData == OffsetString);
+	BOOST_CHECK(ExpectedHashOfDefaultData == SplitString);
+}
+
 BOOST_AUTO_TEST_CASE(TestIndexChunkedDataIncrementalHash)
 {
 	register size_t Count, i;
@@ -2491,4 +2549,22 @@ BOOST_AUTO_TEST_CASE(TestHashCloneIsUnique)
 		Utils::string_format("Expected %d but got %d.", Original->GetBufferSize(), Copy->GetBufferSize()));
 }
 
+BOOST_AUTO_TEST_CASE(TestPooledHashKeyIsReset)
+{
+	HashLibByteArray DefaultKey;
+	{
+		PooledHash<IHashWithKey> keyed = HashLib4CPP::Pool::Acquire(HashLib4CPP::Hash32::CreateXXHash32);
+		DefaultKey = keyed->GetKey();
+		keyed->SetKey(HashLibByteArray(4, 0x7F));
+	}
+
+	PooledHash<IHashWithKey> keyed = HashLib4CPP::Pool::Acquire(HashLib4CPP::Hash32::CreateXXHash32);
+	BOOST_CHECK(DefaultKey == keyed->GetKey());
+}
+
+BOOST_AUTO_TEST_CASE(TestConstexprMatchesRuntime)
+{
+	ConstexprMatchesRuntime<uint32_t>(HashLib4CPP::Constexpr::XXHash32, xxhash32);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -92,6 +92,11 @@ BOOST_AUTO_TEST_CASE(TestHashCloneIsUnique)
 	HashCloneIsUnique(hash);
 }
 
+BOOST_AUTO_TEST_CASE(TestConstexprMatchesRuntime)
+{
+	ConstexprMatchesRuntime<uint64_t>(HashLib4CPP::Constexpr::FNV64, fnv);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -169,6 +174,11 @@ BOOST_AUTO_TEST_CASE(TestHashCloneIsUnique)
 	HashCloneIsUnique(hash);
 }
 
+BOOST_AUTO_TEST_CASE(TestConstexprMatchesRuntime)
+{
+	ConstexprMatchesRuntime<uint64_t>(HashLib4CPP::Constexpr::FNV1a64, fnv1a);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -590,4 +600,9 @@ BOOST_AUTO_TEST_CASE(TestHashCloneIsUnique)
 	HashCloneIsUnique(hash);
 }
 
+BOOST_AUTO_TEST_CASE(TestConstexprMatchesRuntime)
+{
+	ConstexprMatchesRuntime<uint64_t>(HashLib4CPP::Constexpr::XXHash64, xxhash64);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -211,6 +211,38 @@ void HMACCloneIsCorrect(const IHash hash)
 		Utils::string_format('%s HMACCloneIsCorrectTest -> Expected %s but got %s.', hash->GetName(), ExpectedString, ActualString));
 }
 
+// Compares a constexpr hash with its runtime hash on every prefix of a
+// message long enough to reach all of its block and tail paths.
+template <typename T, typename F>
+void ConstexprPrefixesMatchRuntime(const F constexprhash, const IHash hash)
+{
+	string Data = DefaultData + OnetoNine + DefaultData + OnetoNine + DefaultData;
+
+	for (size_t i = 0; i <= Data.size(); i++)
+	{
+		IHashResult Result = hash->ComputeString(Data.substr(0, i));
+		uint64_t Expected = sizeof(T) == 4 ? Result->GetUInt32() : Result->GetUInt64();
+
+		BOOST_CHECK(Expected == constexprhash(Data.data(), i));
+	} // end for
+}
+
+template <typename T>
+void ConstexprMatchesRuntime(T(*constexprhash)(const char *, const size_t), const IHash hash)
+{
+	ConstexprPrefixesMatchRuntime<T>(constexprhash, hash);
+}
+
+// keyed hashes are compared under the runtime default key of zero
+template <typename T>
+void ConstexprMatchesRuntime(T(*constexprhash)(const char *, const size_t, const T), const IHash hash)
+{
+	ConstexprPrefixesMatchRuntime<T>([constexprhash](const char *a_data, const size_t a_length)
+	{
+		return constexprhash(a_data, a_length, 0);
+	}, hash);
+}
+
 
 #endif // !TESTCONSTANTS_H
 
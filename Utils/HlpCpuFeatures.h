@@ -0,0 +1,347 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPCPUFEATURES_H
+#define HLPCPUFEATURES_H
+
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <list>
+#include <mutex>
+#include "HlpHashLibTypes.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	#define HASHLIB_X86
+#endif
+
+#ifdef HASHLIB_X86
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+
+	// Lets GCC and Clang emit instructions the rest of the build may not
+	// assume; MSVC accepts any intrinsic without it.
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#define HASHLIB_TARGET(a_features)
+	#else
+		#define HASHLIB_TARGET(a_features) __attribute__((target(a_features)))
+	#endif
+#endif
+
+
+/// <summary>
+/// Instruction set extensions an accelerated kernel may depend on. The
+/// AVX family is only reported when the OS also saves the wider registers.
+/// </summary>
+enum CpuFeature
+{
+	CpuSSSE3 = 0x1,
+	CpuSSE41 = 0x2,
+	CpuSSE42 = 0x4,
+	CpuAVX = 0x8,
+	CpuAVX2 = 0x10,
+	CpuBMI2 = 0x20,
+	/// <summary>
+	/// AVX-512 F, BW and VL together.
+	/// </summary>
+	CpuAVX512 = 0x40,
+	CpuSHA = 0x80,
+	CpuPCLMULQDQ = 0x100,
+	CpuVPCLMULQDQ = 0x200
+
+}; // end enum CpuFeature
+
+
+/// <summary>
+/// Probes the CPU once and tells the kernel tables which extensions they
+/// may use. Features can be withdrawn for testing and benchmarking, either
+/// with "SetDisabled" or, before the first hash is created, through the
+/// environment variable HASHLIB4CPP_DISABLE_CPU_FEATURES holding a comma
+/// separated list of the names of "GetNames", e.g. "sha,avx2", or "all".
+/// A kernel can also be picked by name, e.g. "AVX2", with "SetForcedKernel"
+/// or the environment variable HASHLIB4CPP_FORCE_KERNEL; tables that lack
+/// it, or whose copy needs a withdrawn feature, select as usual.
+/// </summary>
+class CpuFeatures
+{
+public:
+	static uint32_t GetDetected()
+	{
+		static const uint32_t LDetected = Probe();
+
+		return LDetected;
+	} // end function GetDetected
+
+	static inline uint32_t GetEnabled()
+	{
+		return GetDetected() & ~GetDisabledFlags().load(memory_order_relaxed);
+	} // end function GetEnabled
+
+	static inline bool HasAll(const uint32_t a_features)
+	{
+		return (GetEnabled() & a_features) == a_features;
+	} // end function HasAll
+
+	static inline uint32_t GetDisabled()
+	{
+		return GetDisabledFlags().load(memory_order_relaxed);
+	} // end function GetDisabled
+
+	// Applies to instances created afterwards; existing ones keep their kernel.
+	static inline void SetDisabled(const uint32_t a_features)
+	{
+		GetDisabledFlags().store(a_features, memory_order_relaxed);
+	} // end function SetDisabled
+
+	static string GetForcedKernel()
+	{
+		const string *LForced = PeekForcedKernel();
+
+		return LForced == nullptr ? string() : *LForced;
+	} // end function GetForcedKernel
+
+	// The forced name, or nullptr when none is set. Takes no lock and copies
+	// nothing, so creating an instance stays cheap; the string stays valid
+	// for the life of the program.
+	static inline const string * PeekForcedKernel()
+	{
+		return GetForcedName().load(memory_order_acquire);
+	} // end function PeekForcedKernel
+
+	// Applies to instances created afterwards; an empty name restores the
+	// normal selection. Names compare case-insensitively.
+	static void SetForcedKernel(const string &a_name)
+	{
+		// runs the environment default's Publish before ours takes the lock
+		atomic<const string *> &LForced = GetForcedName();
+		lock_guard<mutex> LLock(GetForcedLock());
+
+		LForced.store(Publish(a_name), memory_order_release);
+	} // end function SetForcedKernel
+
+	static bool SameName(const string &a_left, const char *a_right)
+	{
+		register size_t i = 0;
+
+		for (; i < a_left.size() && a_right[i] != 0; i++)
+		{
+			if (tolower((unsigned char)a_left[i]) != tolower((unsigned char)a_right[i]))
+				return false;
+		} // end for
+
+		return i == a_left.size() && a_right[i] == 0;
+	} // end function SameName
+
+	// Space separated names of a_features, e.g. "avx2 sha".
+	static string GetNames(const uint32_t a_features)
+	{
+		string LResult;
+
+		for (register size_t i = 0; i < FEATURE_COUNT; i++)
+		{
+			if ((a_features & (uint32_t(1) << i)) == 0)
+				continue;
+
+			if (!LResult.empty())
+				LResult.push_back(' ');
+			LResult.append(Names[i]);
+		} // end for
+
+		return LResult;
+	} // end function GetNames
+
+	// Inverse of "GetNames", also accepting commas and "all". Unknown
+	// names are ignored so an outdated setting cannot stop the program.
+	static uint32_t ParseNames(const string &a_names)
+	{
+		uint32_t LResult = 0;
+		size_t LStart = 0, LEnd;
+		string LName;
+
+		while (LStart < a_names.size())
+		{
+			LEnd = a_names.find_first_of(", ", LStart);
+			if (LEnd == string::npos)
+				LEnd = a_names.size();
+
+			LName = a_names.substr(LStart, LEnd - LStart);
+			for (register size_t i = 0; i < LName.size(); i++)
+				LName[i] = char(tolower((unsigned char)LName[i]));
+
+			if (LName == "all")
+				LResult = ~uint32_t(0);
+
+			for (register size_t i = 0; i < FEATURE_COUNT; i++)
+			{
+				if (LName == Names[i])
+					LResult = LResult | (uint32_t(1) << i);
+			} // end for
+
+			LStart = LEnd + 1;
+		} // end while
+
+		return LResult;
+	} // end function ParseNames
+
+private:
+	static atomic<uint32_t> & GetDisabledFlags()
+	{
+		static atomic<uint32_t> LDisabled(ReadEnvironment());
+
+		return LDisabled;
+	} // end function GetDisabledFlags
+
+	static atomic<const string *> & GetForcedName()
+	{
+		static atomic<const string *> LForced(Publish(ReadEnvironment("HASHLIB4CPP_FORCE_KERNEL")));
+
+		return LForced;
+	} // end function GetForcedName
+
+	// Returns an immutable copy of a_name, or nullptr for an empty one.
+	// Copies are never freed, so a reader still holding an older name is
+	// safe; a name set again reuses its copy. Called under the forced lock,
+	// except once for the environment default.
+	static const string * Publish(const string &a_name)
+	{
+		static list<string> LNames;
+
+		if (a_name.empty())
+			return nullptr;
+
+		for (list<string>::const_iterator it = LNames.begin(); it != LNames.end(); ++it)
+		{
+			if (*it == a_name)
+				return &(*it);
+		} // end for
+
+		LNames.push_back(a_name);
+
+		return &LNames.back();
+	} // end function Publish
+
+	static mutex & GetForcedLock()
+	{
+		static mutex LLock;
+
+		return LLock;
+	} // end function GetForcedLock
+
+	static string ReadEnvironment(const char *a_name)
+	{
+		const char *LValue = getenv(a_name);
+
+		return LValue == nullptr ? string() : string(LValue);
+	} // end function ReadEnvironment
+
+	static uint32_t ReadEnvironment()
+	{
+		const char *LValue = getenv("HASHLIB4CPP_DISABLE_CPU_FEATURES");
+
+		return LValue == nullptr ? 0 : ParseNames(LValue);
+	} // end function ReadEnvironment
+
+	static uint32_t Probe()
+	{
+		uint32_t LResult = 0;
+
+#ifdef HASHLIB_X86
+		uint32_t LRegs[4], LMaxLeaf;
+		uint64_t LXCR0 = 0;
+
+		CpuId(0, LRegs);
+		LMaxLeaf = LRegs[0];
+		if (LMaxLeaf < 1)
+			return 0;
+
+		CpuId(1, LRegs);
+		if (LRegs[2] & (uint32_t(1) << 9))
+			LResult = LResult | CpuSSSE3;
+		if (LRegs[2] & (uint32_t(1) << 19))
+			LResult = LResult | CpuSSE41;
+		if (LRegs[2] & (uint32_t(1) << 20))
+			LResult = LResult | CpuSSE42;
+		if (LRegs[2] & (uint32_t(1) << 1))
+			LResult = LResult | CpuPCLMULQDQ;
+
+		// OSXSAVE and AVX, then whether the OS saves the YMM and ZMM state
+		if ((LRegs[2] & (uint32_t(1) << 27)) && (LRegs[2] & (uint32_t(1) << 28)))
+			LXCR0 = XGetBV();
+
+		const bool LYmm = (LXCR0 & 0x06) == 0x06;
+		const bool LZmm = (LXCR0 & 0xE6) == 0xE6;
+
+		if (LYmm)
+			LResult = LResult | CpuAVX;
+
+		if (LMaxLeaf >= 7)
+		{
+			CpuId(7, LRegs);
+			if (LRegs[1] & (uint32_t(1) << 29))
+				LResult = LResult | CpuSHA;
+			if (LRegs[1] & (uint32_t(1) << 8))
+				LResult = LResult | CpuBMI2;
+			if (LYmm && (LRegs[1] & (uint32_t(1) << 5)))
+				LResult = LResult | CpuAVX2;
+			if (LZmm && (LRegs[1] & (uint32_t(1) << 16)) && (LRegs[1] & (uint32_t(1) << 30))
+				&& (LRegs[1] & (uint32_t(1) << 31)))
+				LResult = LResult | CpuAVX512;
+			if (LYmm && (LRegs[2] & (uint32_t(1) << 10)))
+				LResult = LResult | CpuVPCLMULQDQ;
+		} // end if
+#endif
+
+		return LResult;
+	} // end function Probe
+
+#ifdef HASHLIB_X86
+	// eax, ebx, ecx, edx of leaf a_leaf, sub-leaf 0
+	static inline void CpuId(const uint32_t a_leaf, uint32_t *a_regs)
+	{
+	#ifdef _MSC_VER
+		int LRegs[4];
+		__cpuidex(LRegs, int(a_leaf), 0);
+		for (register int32_t i = 0; i < 4; i++)
+			a_regs[i] = uint32_t(LRegs[i]);
+	#else
+		__cpuid_count(a_leaf, 0, a_regs[0], a_regs[1], a_regs[2], a_regs[3]);
+	#endif
+	} // end function CpuId
+
+	static inline uint64_t XGetBV()
+	{
+	#ifdef _MSC_VER
+		return uint64_t(_xgetbv(0));
+	#else
+		uint32_t LLow, LHigh;
+		__asm__ __volatile__("xgetbv" : "=a"(LLow), "=d"(LHigh) : "c"(0));
+		return (uint64_t(LHigh) << 32) | LLow;
+	#endif
+	} // end function XGetBV
+#endif
+
+	static const size_t FEATURE_COUNT = 10;
+	static const char *Names[FEATURE_COUNT];
+
+}; // end class CpuFeatures
+
+const char *CpuFeatures::Names[CpuFeatures::FEATURE_COUNT] = { "ssse3", "sse4.1", "sse4.2",
+	"avx", "avx2", "bmi2", "avx512", "sha", "pclmulqdq", "vpclmulqdq" };
+
+
+#endif // !HLPCPUFEATURES_H
@@ -16,6 +16,7 @@
 #ifndef HLPHASHLIBTYPES_H
 #define HLPHASHLIBTYPES_H
 
+#include <array>
 #include <memory>
 #include <utility>
 #include <stdexcept>
@@ -152,6 +153,48 @@ typedef vector<HashLibUInt32Array> HashLibMatrixUInt32Array;
 /// </summary>
 typedef vector<HashLibUInt64Array> HashLibMatrixUInt64Array;
 
+/// <summary>
+/// A contiguous run of bytes owned by the caller, one fragment of a
+/// scattered message.
+/// </summary>
+struct HashLibSpan
+{
+	const uint8_t *data;
+	int64_t length;
+}; // end struct HashLibSpan
+
+/// <summary>
+/// Represents a dynamic array of HashLibSpan.
+/// </summary>
+typedef vector<HashLibSpan> HashLibSpanArray;
+
+/// <summary>
+/// Enum of the ways "TransformFile" and "ComputeFile" can read a file.
+/// </summary>
+enum FileReadMode
+{
+	/// <summary>
+	/// Read through a buffered "ifstream".
+	/// </summary>
+	FileReadStream = 0,
+
+	/// <summary>
+	/// Map the file into memory and hash the mapped pages in place.
+	/// Falls back to plain reads for pipes, devices and platforms without mmap.
+	/// </summary>
+	FileReadMapped,
+
+	/// <summary>
+	/// Read with O_DIRECT (F_NOCACHE on macOS) into large aligned buffers so
+	/// the file does not pass through, nor evict anything from, the page cache.
+	/// Several chunks are read at once, as many as the read ahead depth and at
+	/// least four, to keep the device queue full.
+	/// Falls back to "FileReadStream" where unbuffered reads are not supported.
+	/// </summary>
+	FileReadDirect
+
+}; // end enum FileReadMode
+
 
 /// <summary>
 /// Enum of all defined and implemented CRC standards.
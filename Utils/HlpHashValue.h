@@ -0,0 +1,167 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPHASHVALUE_H
+#define HLPHASHVALUE_H
+
+#include <cstring>
+#include "../Base/HlpConverters.h"
+#include "../Interfaces/HlpIHashResult.h"
+
+
+/// <summary>
+/// Digest held by value in fixed inline storage. Unlike "IHashResult" it
+/// never touches the heap and is copied or moved with a plain memberwise
+/// copy, which makes it suitable for large in-memory indexes of digests.
+/// </summary>
+class HashValue
+{
+public:
+	HashValue()
+		: length(0)
+	{} // end constructor
+
+	HashValue(const uint8_t *a_data, const size_t a_length)
+	{
+		SetLength(a_length);
+
+		if (a_length > 0)
+			memmove(data, a_data, a_length * sizeof(uint8_t));
+	} // end constructor
+
+	explicit HashValue(const IHashResult &a_result)
+	{
+		HashLibByteArray LBytes = a_result->GetBytes();
+
+		SetLength(LBytes.size());
+
+		if (!LBytes.empty())
+			memmove(data, &LBytes[0], LBytes.size() * sizeof(uint8_t));
+	} // end constructor
+
+	// Resizes the digest, leaving the bytes to be written through GetData().
+	inline void SetLength(const size_t a_length)
+	{
+		if (a_length > MAX_LENGTH)
+			throw ArgumentOutOfRangeHashLibException(HashValue::DigestTooLarge);
+
+		length = uint8_t(a_length);
+	} // end function SetLength
+
+	inline size_t GetLength() const
+	{
+		return length;
+	} // end function GetLength
+
+	inline const uint8_t * GetData() const
+	{
+		return data;
+	} // end function GetData
+
+	inline uint8_t * GetData()
+	{
+		return data;
+	} // end function GetData
+
+	inline HashLibByteArray GetBytes() const
+	{
+		return HashLibByteArray(data, data + length);
+	} // end function GetBytes
+
+	inline uint32_t GetUInt32() const
+	{
+		if (length != 4)
+			throw InvalidOperationHashLibException(HashValue::ImpossibleRepresentationUInt32);
+
+		return (uint32_t(data[0]) << 24) | (uint32_t(data[1]) << 16) |
+			(uint32_t(data[2]) << 8) | uint32_t(data[3]);
+	} // end function GetUInt32
+
+	inline uint64_t GetUInt64() const
+	{
+		if (length != 8)
+			throw InvalidOperationHashLibException(HashValue::ImpossibleRepresentationUInt64);
+
+		return (uint64_t(GetUInt32At(0)) << 32) | uint64_t(GetUInt32At(4));
+	} // end function GetUInt64
+
+	// Cheap bucket index for hash tables keyed by digest.
+	inline int32_t GetHashCode() const
+	{
+		int32_t LResult = 0;
+
+		for (register size_t I = 0; I < length; I++)
+		{
+			LResult = Bits::RotateLeft32(LResult, 5);
+			LResult = LResult ^ uint32_t(data[I]);
+		} // end for
+
+		return LResult;
+	} // end function GetHashCode
+
+	// Constant time comparison, safe for MACs.
+	inline bool CompareTo(const HashValue &a_value) const
+	{
+		register uint32_t diff = uint32_t(length ^ a_value.length);
+
+		for (register size_t I = 0; I < length && I < a_value.length; I++)
+			diff = diff | uint32_t(data[I] ^ a_value.data[I]);
+
+		return diff == 0;
+	} // end function CompareTo
+
+	inline bool operator==(const HashValue &a_value) const
+	{
+		return length == a_value.length && memcmp(data, a_value.data, length) == 0;
+	} // end function operator==
+
+	inline bool operator!=(const HashValue &a_value) const
+	{
+		return !(*this == a_value);
+	} // end function operator!=
+
+	inline string ToString(const bool a_group = false) const
+	{
+		if (length == 0) return string("");
+		return Converters::ConvertBytesToHexString(data, length, a_group);
+	} // end function ToString
+
+private:
+	inline uint32_t GetUInt32At(const size_t a_index) const
+	{
+		return (uint32_t(data[a_index]) << 24) | (uint32_t(data[a_index + 1]) << 16) |
+			(uint32_t(data[a_index + 2]) << 8) | uint32_t(data[a_index + 3]);
+	} // end function GetUInt32At
+
+public:
+	// largest digest produced by the library (SHA3-512, Blake2B, WhirlPool, ...)
+	static const size_t MAX_LENGTH = 64;
+
+private:
+	static const char *DigestTooLarge;
+	static const char *ImpossibleRepresentationUInt32;
+	static const char *ImpossibleRepresentationUInt64;
+
+	uint8_t data[MAX_LENGTH];
+	uint8_t length;
+
+}; // end class HashValue
+
+const char *HashValue::DigestTooLarge = "Digest Does Not Fit In A HashValue";
+const char *HashValue::ImpossibleRepresentationUInt32 = "Current Data Structure cannot be Represented as an 'UInt32' Type.";
+const char *HashValue::ImpossibleRepresentationUInt64 = "Current Data Structure cannot be Represented as an 'UInt64' Type.";
+
+
+#endif // !HLPHASHVALUE_H
@@ -0,0 +1,296 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library                                 
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald                 
+// *Github Repository <https://github.com/ron4fun>             
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE 
+// *or visit http ://www.opensource.org/licenses/mit-license.php.           
+
+// *Acknowledgements:                                  
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative        
+// *development of this library in Pascal/Delphi                         
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPIOURING_H
+#define HLPIOURING_H
+
+#include "HlpMappedFile.h"
+
+#if defined(__linux__) && defined(__has_include)
+	#if __has_include(<linux/io_uring.h>)
+		#include <linux/io_uring.h>
+		// the opcodes are enumerators, so the 5.6 headers that added
+		// IORING_OP_OPENAT, READ and CLOSE are told apart by a flag from
+		// the same release
+		#ifdef IORING_FEAT_CUR_PERSONALITY
+			#define HASHLIB_IO_URING
+		#endif
+	#endif
+#endif
+
+#ifdef HASHLIB_IO_URING
+	#include <cstring>
+	#include <sched.h>
+	#include <sys/syscall.h>
+#endif
+
+
+/// <summary>
+/// Minimal io_uring submission/completion ring driven through the raw
+/// system calls, so no liburing is required. "Setup" fails on kernels
+/// (or sandboxes) without io_uring and callers are expected to fall back
+/// to their synchronous path.
+/// </summary>
+class IoUring
+{
+public:
+#ifdef HASHLIB_IO_URING
+	typedef struct io_uring_sqe Submission;
+	typedef struct io_uring_cqe Completion;
+#else
+	struct Submission {};
+	struct Completion { uint64_t user_data; int32_t res; uint32_t flags; };
+#endif
+
+	IoUring()
+		: handle(-1), sq_ring(nullptr), cq_ring(nullptr), sqes(nullptr),
+		sq_ring_length(0), cq_ring_length(0), sqes_length(0), queued(0), pending(0),
+		in_flight(0)
+	{} // end constructor
+
+	~IoUring()
+	{
+		Close();
+	} // end destructor
+
+	bool Setup(const uint32_t a_entries)
+	{
+		Close();
+
+#ifdef HASHLIB_IO_URING
+		struct io_uring_params LParams;
+		void *LView;
+
+		memset(&LParams, 0, sizeof(LParams));
+
+		handle = int(syscall(__NR_io_uring_setup, a_entries, &LParams));
+		if (handle < 0)
+		{
+			handle = -1;
+			return false;
+		} // end if
+
+		sq_ring_length = LParams.sq_off.array + LParams.sq_entries * sizeof(uint32_t);
+		cq_ring_length = LParams.cq_off.cqes + LParams.cq_entries * sizeof(Completion);
+
+		if (LParams.features & IORING_FEAT_SINGLE_MMAP)
+		{
+			if (cq_ring_length > sq_ring_length) sq_ring_length = cq_ring_length;
+			cq_ring_length = 0;
+		} // end if
+
+		LView = mmap(nullptr, sq_ring_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			handle, IORING_OFF_SQ_RING);
+		if (LView == MAP_FAILED)
+		{
+			Close();
+			return false;
+		} // end if
+		sq_ring = (uint8_t *)LView;
+
+		if (cq_ring_length == 0)
+			cq_ring = sq_ring;
+		else
+		{
+			LView = mmap(nullptr, cq_ring_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+				handle, IORING_OFF_CQ_RING);
+			if (LView == MAP_FAILED)
+			{
+				Close();
+				return false;
+			} // end if
+			cq_ring = (uint8_t *)LView;
+		} // end else
+
+		sqes_length = LParams.sq_entries * sizeof(Submission);
+		LView = mmap(nullptr, sqes_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			handle, IORING_OFF_SQES);
+		if (LView == MAP_FAILED)
+		{
+			Close();
+			return false;
+		} // end if
+		sqes = (Submission *)LView;
+
+		sq_head = (uint32_t *)(sq_ring + LParams.sq_off.head);
+		sq_tail = (uint32_t *)(sq_ring + LParams.sq_off.tail);
+		sq_mask = *(uint32_t *)(sq_ring + LParams.sq_off.ring_mask);
+		sq_entries = LParams.sq_entries;
+		sq_array = (uint32_t *)(sq_ring + LParams.sq_off.array);
+
+		cq_head = (uint32_t *)(cq_ring + LParams.cq_off.head);
+		cq_tail = (uint32_t *)(cq_ring + LParams.cq_off.tail);
+		cq_mask = *(uint32_t *)(cq_ring + LParams.cq_off.ring_mask);
+		cqes = (Completion *)(cq_ring + LParams.cq_off.cqes);
+
+		return true;
+#else
+		(void)a_entries;
+		return false;
+#endif
+	} // end function Setup
+
+	void Close()
+	{
+#ifdef HASHLIB_IO_URING
+		if (sqes) munmap(sqes, sqes_length);
+		if (cq_ring && cq_ring != sq_ring) munmap(cq_ring, cq_ring_length);
+		if (sq_ring) munmap(sq_ring, sq_ring_length);
+		if (handle != -1) close(handle);
+#endif
+
+		handle = -1;
+		sq_ring = nullptr;
+		cq_ring = nullptr;
+		sqes = nullptr;
+		queued = 0;
+		pending = 0;
+		in_flight = 0;
+	} // end function Close
+
+	// Returns a cleared submission entry, or nullptr when the queue is full.
+	// The entry only becomes visible to the kernel on the next "Submit", so
+	// it can be filled in at leisure.
+	Submission * GetSubmission()
+	{
+#ifdef HASHLIB_IO_URING
+		uint32_t LTail = *sq_tail + queued;
+		Submission *LEntry;
+
+		if (LTail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) >= sq_entries)
+			return nullptr;
+
+		LEntry = &sqes[LTail & sq_mask];
+		memset(LEntry, 0, sizeof(Submission));
+
+		sq_array[LTail & sq_mask] = LTail & sq_mask;
+		queued++;
+
+		return LEntry;
+#else
+		return nullptr;
+#endif
+	} // end function GetSubmission
+
+	// Submits the queued entries and waits until at least a_wait_for
+	// completions are available. If the kernel is short of resources it
+	// waits for a completion instead, leaving the entries pending for the
+	// next call. Returns false on an unrecoverable error, or when short of
+	// resources with nothing in flight that could free them.
+	bool Submit(const uint32_t a_wait_for)
+	{
+#ifdef HASHLIB_IO_URING
+		long LResult;
+
+		// publish the entries handed out since the last call, now that they
+		// are complete
+		if (queued > 0)
+		{
+			__atomic_store_n(sq_tail, *sq_tail + queued, __ATOMIC_RELEASE);
+			pending = pending + queued;
+			queued = 0;
+		} // end if
+
+		do
+		{
+			LResult = syscall(__NR_io_uring_enter, handle, pending, a_wait_for,
+				a_wait_for > 0 ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+		} while (LResult < 0 && errno == EINTR);
+
+		if (LResult < 0)
+		{
+			if ((errno != EAGAIN && errno != EBUSY) || in_flight == 0)
+				return false;
+
+			// returning straight away would have the caller spin on the retry
+			WaitForCompletion();
+
+			return true;
+		} // end if
+
+		pending = pending - uint32_t(LResult);
+		in_flight = in_flight + uint32_t(LResult);
+
+		return true;
+#else
+		(void)a_wait_for;
+		return false;
+#endif
+	} // end function Submit
+
+	// Blocks until a completion is ready without submitting anything new.
+	// Polls the ring if the kernel refuses to wait, so it also works after
+	// "Submit" failed. Only meaningful while "GetInFlight" is not zero.
+	void WaitForCompletion()
+	{
+#ifdef HASHLIB_IO_URING
+		long LResult;
+
+		while (*cq_head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE))
+		{
+			LResult = syscall(__NR_io_uring_enter, handle, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+			if (LResult < 0 && errno != EINTR)
+				sched_yield();
+		} // end while
+#endif
+	} // end function WaitForCompletion
+
+	// Number of operations the kernel accepted whose completion was not
+	// popped yet. Their buffers must stay valid until this drops to zero.
+	inline uint32_t GetInFlight() const
+	{
+		return in_flight;
+	} // end function GetInFlight
+
+	// Pops the next completion into a_completion, false if none is ready.
+	bool GetCompletion(Completion &a_completion)
+	{
+#ifdef HASHLIB_IO_URING
+		uint32_t LHead = *cq_head;
+
+		if (LHead == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE))
+			return false;
+
+		a_completion = cqes[LHead & cq_mask];
+		__atomic_store_n(cq_head, LHead + 1, __ATOMIC_RELEASE);
+		in_flight--;
+
+		return true;
+#else
+		(void)a_completion;
+		return false;
+#endif
+	} // end function GetCompletion
+
+private:
+	IoUring(const IoUring &);
+	IoUring& operator=(const IoUring &);
+
+	int handle;
+	uint8_t *sq_ring, *cq_ring;
+	Submission *sqes;
+	Completion *cqes;
+	size_t sq_ring_length, cq_ring_length, sqes_length;
+
+	uint32_t *sq_head, *sq_tail, *sq_array, *cq_head, *cq_tail;
+	uint32_t sq_mask, sq_entries, cq_mask;
+	// queued: handed out but not published, pending: published but not yet
+	// consumed by the kernel
+	uint32_t queued, pending, in_flight;
+
+}; // end class IoUring
+
+
+#endif // !HLPIOURING_H
@@ -0,0 +1,275 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPLANEVECTORS_H
+#define HLPLANEVECTORS_H
+
+#include "HlpCpuFeatures.h"
+
+#ifdef HASHLIB_X86
+	#include <immintrin.h>
+
+
+// Vectors of 32-bit words, one word per lane, for the multi-buffer
+// kernels. A kernel is written once against these operations and stamped
+// out for each instruction set with its matching HASHLIB_TARGET.
+
+struct LaneVectorSSE41
+{
+	typedef __m128i Vector;
+	static const size_t LANES = 4;
+
+	HASHLIB_TARGET("sse4.1")
+	static inline Vector Load(const uint32_t *a_words)
+	{
+		return _mm_load_si128((const __m128i *)a_words);
+	} // end function Load
+
+	HASHLIB_TARGET("sse4.1")
+	static inline void Store(uint32_t *a_words, const Vector a_value)
+	{
+		_mm_store_si128((__m128i *)a_words, a_value);
+	} // end function Store
+
+	HASHLIB_TARGET("sse4.1")
+	static inline Vector Set1(const uint32_t a_value)
+	{
+		return _mm_set1_epi32(int32_t(a_value));
+	} // end function Set1
+
+	HASHLIB_TARGET("sse4.1")
+	static inline Vector Add(const Vector a_x, const Vector a_y)
+	{
+		return _mm_add_epi32(a_x, a_y);
+	} // end function Add
+
+	HASHLIB_TARGET("sse4.1")
+	static inline Vector Xor(const Vector a_x, const Vector a_y)
+	{
+		return _mm_xor_si128(a_x, a_y);
+	} // end function Xor
+
+	HASHLIB_TARGET("sse4.1")
+	static inline Vector Xor3(const Vector a_x, const Vector a_y, const Vector a_z)
+	{
+		return _mm_xor_si128(_mm_xor_si128(a_x, a_y), a_z);
+	} // end function Xor3
+
+	HASHLIB_TARGET("sse4.1")
+	static inline Vector ShiftRight(const Vector a_value, const int32_t a_n)
+	{
+		return _mm_srli_epi32(a_value, a_n);
+	} // end function ShiftRight
+
+	HASHLIB_TARGET("sse4.1")
+	static inline Vector RotateLeft(const Vector a_value, const int32_t a_n)
+	{
+		return _mm_or_si128(_mm_slli_epi32(a_value, a_n), _mm_srli_epi32(a_value, 32 - a_n));
+	} // end function RotateLeft
+
+	HASHLIB_TARGET("sse4.1")
+	static inline Vector RotateRight(const Vector a_value, const int32_t a_n)
+	{
+		return _mm_or_si128(_mm_srli_epi32(a_value, a_n), _mm_slli_epi32(a_value, 32 - a_n));
+	} // end function RotateRight
+
+	// (x & y) ^ (~x & z)
+	HASHLIB_TARGET("sse4.1")
+	static inline Vector Choose(const Vector a_x, const Vector a_y, const Vector a_z)
+	{
+		return _mm_xor_si128(_mm_and_si128(a_x, a_y), _mm_andnot_si128(a_x, a_z));
+	} // end function Choose
+
+	// (x & y) ^ (x & z) ^ (y & z)
+	HASHLIB_TARGET("sse4.1")
+	static inline Vector Majority(const Vector a_x, const Vector a_y, const Vector a_z)
+	{
+		return _mm_or_si128(_mm_and_si128(a_x, a_y), _mm_and_si128(_mm_or_si128(a_x, a_y), a_z));
+	} // end function Majority
+
+	// y ^ (x | ~z), MD5's "I"
+	HASHLIB_TARGET("sse4.1")
+	static inline Vector XorOrNot(const Vector a_x, const Vector a_y, const Vector a_z)
+	{
+		return _mm_xor_si128(a_y, _mm_or_si128(a_x, _mm_xor_si128(a_z, _mm_set1_epi32(-1))));
+	} // end function XorOrNot
+
+}; // end struct LaneVectorSSE41
+
+struct LaneVectorAVX2
+{
+	typedef __m256i Vector;
+	static const size_t LANES = 8;
+
+	HASHLIB_TARGET("avx2")
+	static inline Vector Load(const uint32_t *a_words)
+	{
+		return _mm256_load_si256((const __m256i *)a_words);
+	} // end function Load
+
+	HASHLIB_TARGET("avx2")
+	static inline void Store(uint32_t *a_words, const Vector a_value)
+	{
+		_mm256_store_si256((__m256i *)a_words, a_value);
+	} // end function Store
+
+	HASHLIB_TARGET("avx2")
+	static inline Vector Set1(const uint32_t a_value)
+	{
+		return _mm256_set1_epi32(int32_t(a_value));
+	} // end function Set1
+
+	HASHLIB_TARGET("avx2")
+	static inline Vector Add(const Vector a_x, const Vector a_y)
+	{
+		return _mm256_add_epi32(a_x, a_y);
+	} // end function Add
+
+	HASHLIB_TARGET("avx2")
+	static inline Vector Xor(const Vector a_x, const Vector a_y)
+	{
+		return _mm256_xor_si256(a_x, a_y);
+	} // end function Xor
+
+	HASHLIB_TARGET("avx2")
+	static inline Vector Xor3(const Vector a_x, const Vector a_y, const Vector a_z)
+	{
+		return _mm256_xor_si256(_mm256_xor_si256(a_x, a_y), a_z);
+	} // end function Xor3
+
+	HASHLIB_TARGET("avx2")
+	static inline Vector ShiftRight(const Vector a_value, const int32_t a_n)
+	{
+		return _mm256_srli_epi32(a_value, a_n);
+	} // end function ShiftRight
+
+	HASHLIB_TARGET("avx2")
+	static inline Vector RotateLeft(const Vector a_value, const int32_t a_n)
+	{
+		return _mm256_or_si256(_mm256_slli_epi32(a_value, a_n), _mm256_srli_epi32(a_value, 32 - a_n));
+	} // end function RotateLeft
+
+	HASHLIB_TARGET("avx2")
+	static inline Vector RotateRight(const Vector a_value, const int32_t a_n)
+	{
+		return _mm256_or_si256(_mm256_srli_epi32(a_value, a_n), _mm256_slli_epi32(a_value, 32 - a_n));
+	} // end function RotateRight
+
+	HASHLIB_TARGET("avx2")
+	static inline Vector Choose(const Vector a_x, const Vector a_y, const Vector a_z)
+	{
+		return _mm256_xor_si256(_mm256_and_si256(a_x, a_y), _mm256_andnot_si256(a_x, a_z));
+	} // end function Choose
+
+	HASHLIB_TARGET("avx2")
+	static inline Vector Majority(const Vector a_x, const Vector a_y, const Vector a_z)
+	{
+		return _mm256_or_si256(_mm256_and_si256(a_x, a_y),
+			_mm256_and_si256(_mm256_or_si256(a_x, a_y), a_z));
+	} // end function Majority
+
+	HASHLIB_TARGET("avx2")
+	static inline Vector XorOrNot(const Vector a_x, const Vector a_y, const Vector a_z)
+	{
+		return _mm256_xor_si256(a_y, _mm256_or_si256(a_x, _mm256_xor_si256(a_z, _mm256_set1_epi32(-1))));
+	} // end function XorOrNot
+
+}; // end struct LaneVectorAVX2
+
+// AVX-512 has native rotates and evaluates any three-input boolean
+// function in one "vpternlogd".
+struct LaneVectorAVX512
+{
+	typedef __m512i Vector;
+	static const size_t LANES = 16;
+
+	HASHLIB_TARGET("avx512f")
+	static inline Vector Load(const uint32_t *a_words)
+	{
+		return _mm512_load_si512((const void *)a_words);
+	} // end function Load
+
+	HASHLIB_TARGET("avx512f")
+	static inline void Store(uint32_t *a_words, const Vector a_value)
+	{
+		_mm512_store_si512((void *)a_words, a_value);
+	} // end function Store
+
+	HASHLIB_TARGET("avx512f")
+	static inline Vector Set1(const uint32_t a_value)
+	{
+		return _mm512_set1_epi32(int32_t(a_value));
+	} // end function Set1
+
+	HASHLIB_TARGET("avx512f")
+	static inline Vector Add(const Vector a_x, const Vector a_y)
+	{
+		return _mm512_add_epi32(a_x, a_y);
+	} // end function Add
+
+	HASHLIB_TARGET("avx512f")
+	static inline Vector Xor(const Vector a_x, const Vector a_y)
+	{
+		return _mm512_xor_si512(a_x, a_y);
+	} // end function Xor
+
+	HASHLIB_TARGET("avx512f")
+	static inline Vector Xor3(const Vector a_x, const Vector a_y, const Vector a_z)
+	{
+		return _mm512_ternarylogic_epi32(a_x, a_y, a_z, 0x96);
+	} // end function Xor3
+
+	HASHLIB_TARGET("avx512f")
+	static inline Vector ShiftRight(const Vector a_value, const int32_t a_n)
+	{
+		return _mm512_srli_epi32(a_value, uint32_t(a_n));
+	} // end function ShiftRight
+
+	HASHLIB_TARGET("avx512f")
+	static inline Vector RotateLeft(const Vector a_value, const int32_t a_n)
+	{
+		return _mm512_rolv_epi32(a_value, _mm512_set1_epi32(a_n));
+	} // end function RotateLeft
+
+	HASHLIB_TARGET("avx512f")
+	static inline Vector RotateRight(const Vector a_value, const int32_t a_n)
+	{
+		return _mm512_rorv_epi32(a_value, _mm512_set1_epi32(a_n));
+	} // end function RotateRight
+
+	HASHLIB_TARGET("avx512f")
+	static inline Vector Choose(const Vector a_x, const Vector a_y, const Vector a_z)
+	{
+		return _mm512_ternarylogic_epi32(a_x, a_y, a_z, 0xCA);
+	} // end function Choose
+
+	HASHLIB_TARGET("avx512f")
+	static inline Vector Majority(const Vector a_x, const Vector a_y, const Vector a_z)
+	{
+		return _mm512_ternarylogic_epi32(a_x, a_y, a_z, 0xE8);
+	} // end function Majority
+
+	HASHLIB_TARGET("avx512f")
+	static inline Vector XorOrNot(const Vector a_x, const Vector a_y, const Vector a_z)
+	{
+		return _mm512_ternarylogic_epi32(a_x, a_y, a_z, 0x39);
+	} // end function XorOrNot
+
+}; // end struct LaneVectorAVX512
+
+
+#endif // HASHLIB_X86
+
+#endif // !HLPLANEVECTORS_H
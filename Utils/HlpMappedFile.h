@@ -0,0 +1,209 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library                                 
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald                 
+// *Github Repository <https://github.com/ron4fun>             
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE 
+// *or visit http ://www.opensource.org/licenses/mit-license.php.           
+
+// *Acknowledgements:                                  
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative        
+// *development of this library in Pascal/Delphi                         
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPMAPPEDFILE_H
+#define HLPMAPPEDFILE_H
+
+#include "HlpHashLibTypes.h"
+
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+	#define HASHLIB_POSIX_IO
+#endif
+
+#ifdef HASHLIB_POSIX_IO
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+
+/// <summary>
+/// Read only view of a file that is mapped into memory one window at a time,
+/// so files larger than the address space budget can still be mapped.
+/// On platforms without POSIX I/O the file can never be opened and callers
+/// are expected to fall back to their stream based path.
+/// </summary>
+class MappedFile
+{
+public:
+	MappedFile()
+		: handle(-1), size(0), is_regular(false), view(nullptr), view_length(0)
+	{} // end constructor
+
+	~MappedFile()
+	{
+		Close();
+	} // end destructor
+
+	// With a_direct the file is opened for reads that bypass the page cache,
+	// which then must be aligned to GetPageSize() in offset, length and address.
+	bool Open(const string &a_file_name, const bool a_direct = false)
+	{
+		Close();
+
+#ifdef HASHLIB_POSIX_IO
+		struct stat info;
+		int LFlags = O_RDONLY;
+
+		if (a_direct)
+		{
+	#if defined(O_DIRECT)
+			LFlags = LFlags | O_DIRECT;
+	#elif !defined(F_NOCACHE)
+			return false;
+	#endif
+		} // end if
+
+		do
+		{
+			handle = open(a_file_name.c_str(), LFlags);
+		} while (handle == -1 && errno == EINTR);
+
+		if (handle == -1)
+			return false;
+
+	#if !defined(O_DIRECT) && defined(F_NOCACHE)
+		if (a_direct && fcntl(handle, F_NOCACHE, 1) == -1)
+		{
+			Close();
+			return false;
+		} // end if
+	#endif
+
+		if (fstat(handle, &info) != 0)
+		{
+			Close();
+			return false;
+		} // end if
+
+		is_regular = S_ISREG(info.st_mode);
+		size = is_regular ? int64_t(info.st_size) : 0;
+
+		return true;
+#else
+		return false;
+#endif
+	} // end function Open
+
+	void Close()
+	{
+		Unmap();
+
+#ifdef HASHLIB_POSIX_IO
+		if (handle != -1)
+			close(handle);
+#endif
+
+		handle = -1;
+		size = 0;
+		is_regular = false;
+	} // end function Close
+
+	// Maps [a_offset, a_offset + a_length) and returns a pointer to a_offset,
+	// or nullptr if the range could not be mapped.
+	const uint8_t * Map(const int64_t a_offset, const int64_t a_length)
+	{
+		Unmap();
+
+#ifdef HASHLIB_POSIX_IO
+		int64_t LAlignedOffset, LDelta;
+		void *LView;
+
+		if (!is_regular || a_length <= 0)
+			return nullptr;
+
+		// mmap offsets must be page aligned
+		LAlignedOffset = a_offset - (a_offset % GetPageSize());
+		LDelta = a_offset - LAlignedOffset;
+
+		LView = mmap(nullptr, size_t(a_length + LDelta), PROT_READ, MAP_SHARED, handle, off_t(LAlignedOffset));
+		if (LView == MAP_FAILED)
+			return nullptr;
+
+		view = (uint8_t *)LView;
+		view_length = size_t(a_length + LDelta);
+
+	#ifdef MADV_SEQUENTIAL
+		madvise(view, view_length, MADV_SEQUENTIAL);
+	#endif
+	#ifdef MADV_HUGEPAGE
+		madvise(view, view_length, MADV_HUGEPAGE);
+	#endif
+
+		return view + LDelta;
+#else
+		return nullptr;
+#endif
+	} // end function Map
+
+	void Unmap()
+	{
+#ifdef HASHLIB_POSIX_IO
+		if (view)
+			munmap(view, view_length);
+#endif
+
+		view = nullptr;
+		view_length = 0;
+	} // end function Unmap
+
+	inline int GetHandle() const
+	{
+		return handle;
+	} // end function GetHandle
+
+	inline int64_t GetSize() const
+	{
+		return size;
+	} // end function GetSize
+
+	inline bool GetIsRegular() const
+	{
+		return is_regular;
+	} // end function GetIsRegular
+
+	static inline int64_t GetPageSize()
+	{
+#ifdef HASHLIB_POSIX_IO
+		static const int64_t PageSize = int64_t(sysconf(_SC_PAGESIZE));
+
+		return PageSize;
+#else
+		return 4096;
+#endif
+	} // end function GetPageSize
+
+private:
+	MappedFile(const MappedFile &);
+	MappedFile& operator=(const MappedFile &);
+
+public:
+	// Largest range mapped at once; kept small on 32-bit targets where the
+	// address space is the limiting factor.
+	static const int64_t WINDOW_SIZE = sizeof(void *) >= 8 ? int64_t(1024 * 1024 * 1024) : int64_t(64 * 1024 * 1024);
+
+private:
+	int handle;
+	int64_t size;
+	bool is_regular;
+	uint8_t *view;
+	size_t view_length;
+
+}; // end class MappedFile
+
+
+#endif // !HLPMAPPEDFILE_H
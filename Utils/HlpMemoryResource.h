@@ -0,0 +1,315 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald
+// *Github Repository <https://github.com/ron4fun>
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE
+// *or visit http ://www.opensource.org/licenses/mit-license.php.
+
+// *Acknowledgements:
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative
+// *development of this library in Pascal/Delphi
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPMEMORYRESOURCE_H
+#define HLPMEMORYRESOURCE_H
+
+#include <cstddef>
+#include <new>
+#include "HlpHashLibTypes.h"
+
+
+/// <summary>
+/// Source of raw memory for results and scratch arrays, modelled on the
+/// C++17 "std::pmr::memory_resource" so the library keeps building as C++11.
+/// </summary>
+class MemoryResource
+{
+public:
+	virtual ~MemoryResource()
+	{} // end destructor
+
+	inline void * Allocate(const size_t a_bytes, const size_t a_alignment = alignof(max_align_t))
+	{
+		return DoAllocate(a_bytes, a_alignment);
+	} // end function Allocate
+
+	inline void Deallocate(void *a_ptr, const size_t a_bytes, const size_t a_alignment = alignof(max_align_t))
+	{
+		DoDeallocate(a_ptr, a_bytes, a_alignment);
+	} // end function Deallocate
+
+	inline bool IsEqual(const MemoryResource &a_other) const
+	{
+		return this == &a_other || DoIsEqual(a_other);
+	} // end function IsEqual
+
+	// Plain operator new and delete, used wherever no resource is given.
+	static MemoryResource & GetDefault();
+
+protected:
+	virtual void * DoAllocate(const size_t a_bytes, const size_t a_alignment) = 0;
+	virtual void DoDeallocate(void *a_ptr, const size_t a_bytes, const size_t a_alignment) = 0;
+
+	virtual bool DoIsEqual(const MemoryResource &a_other) const
+	{
+		return this == &a_other;
+	} // end function DoIsEqual
+
+}; // end class MemoryResource
+
+
+/// <summary>
+/// Plain operator new and delete. C++11 has no aligned new, so alignments
+/// above that of "max_align_t" are honoured by over-allocating and keeping
+/// the pointer new returned just in front of the aligned block.
+/// </summary>
+class NewDeleteMemoryResource : public MemoryResource
+{
+public:
+	static const char *InvalidAlignment;
+
+protected:
+	virtual void * DoAllocate(const size_t a_bytes, const size_t a_alignment)
+	{
+		uint8_t *LBase;
+		uintptr_t LAligned;
+
+		if (a_alignment <= alignof(max_align_t))
+			return ::operator new(a_bytes);
+
+		if ((a_alignment & (a_alignment - 1)) != 0)
+			throw ArgumentHashLibException(NewDeleteMemoryResource::InvalidAlignment);
+
+		LBase = (uint8_t *)::operator new(a_bytes + a_alignment + sizeof(void *));
+		LAligned = (uintptr_t(LBase) + sizeof(void *) + a_alignment - 1) & ~uintptr_t(a_alignment - 1);
+		((void **)LAligned)[-1] = LBase;
+
+		return (void *)LAligned;
+	} // end function DoAllocate
+
+	virtual void DoDeallocate(void *a_ptr, const size_t, const size_t a_alignment)
+	{
+		if (a_alignment <= alignof(max_align_t))
+			::operator delete(a_ptr);
+		else
+			::operator delete(((void **)a_ptr)[-1]);
+	} // end function DoDeallocate
+
+	virtual bool DoIsEqual(const MemoryResource &a_other) const
+	{
+		return dynamic_cast<const NewDeleteMemoryResource *>(&a_other) != nullptr;
+	} // end function DoIsEqual
+
+}; // end class NewDeleteMemoryResource
+
+const char *NewDeleteMemoryResource::InvalidAlignment = "Alignment Must Be A Power Of Two";
+
+inline MemoryResource & MemoryResource::GetDefault()
+{
+	static NewDeleteMemoryResource LResource;
+
+	return LResource;
+} // end function GetDefault
+
+
+/// <summary>
+/// Bump arena. Allocation only moves a pointer forward, deallocation is a
+/// no-op, and "Release()" drops everything at once, e.g. at the end of a
+/// request. Memory comes from an optional caller buffer first and then from
+/// chunks of the upstream resource. Not thread safe.
+/// </summary>
+class MonotonicMemoryResource : public MemoryResource
+{
+public:
+	explicit MonotonicMemoryResource(const size_t a_chunk_size = DEFAULT_CHUNK_SIZE,
+		MemoryResource &a_upstream = MemoryResource::GetDefault())
+		: initial_buffer(nullptr), initial_length(0), chunks(nullptr),
+		chunk_size(a_chunk_size), upstream(&a_upstream)
+	{
+		Release();
+	} // end constructor
+
+	MonotonicMemoryResource(void *a_buffer, const size_t a_length,
+		MemoryResource &a_upstream = MemoryResource::GetDefault())
+		: initial_buffer((uint8_t *)a_buffer), initial_length(a_length), chunks(nullptr),
+		chunk_size(DEFAULT_CHUNK_SIZE), upstream(&a_upstream)
+	{
+		Release();
+	} // end constructor
+
+	~MonotonicMemoryResource()
+	{
+		Release();
+	} // end destructor
+
+	// Returns all chunks to the upstream resource and rewinds to the caller buffer.
+	void Release()
+	{
+		Chunk *LNext;
+
+		while (chunks != nullptr)
+		{
+			LNext = chunks->next;
+			upstream->Deallocate(chunks, chunks->length, alignof(Chunk));
+			chunks = LNext;
+		} // end while
+
+		current = initial_buffer;
+		remaining = initial_length;
+	} // end function Release
+
+protected:
+	virtual void * DoAllocate(const size_t a_bytes, const size_t a_alignment)
+	{
+		void *LResult = Take(a_bytes, a_alignment);
+
+		if (LResult == nullptr)
+		{
+			AddChunk(a_bytes + a_alignment);
+			LResult = Take(a_bytes, a_alignment);
+		} // end if
+
+		return LResult;
+	} // end function DoAllocate
+
+	virtual void DoDeallocate(void *, const size_t, const size_t)
+	{} // end function DoDeallocate
+
+private:
+	struct Chunk
+	{
+		Chunk *next;
+		size_t length;
+	}; // end struct Chunk
+
+	MonotonicMemoryResource(const MonotonicMemoryResource &);
+	MonotonicMemoryResource & operator=(const MonotonicMemoryResource &);
+
+	inline void * Take(const size_t a_bytes, const size_t a_alignment)
+	{
+		size_t LPadding = (a_alignment - size_t(uintptr_t(current) % a_alignment)) % a_alignment;
+
+		if (current == nullptr || LPadding + a_bytes > remaining)
+			return nullptr;
+
+		void *LResult = current + LPadding;
+		current = current + LPadding + a_bytes;
+		remaining = remaining - LPadding - a_bytes;
+
+		return LResult;
+	} // end function Take
+
+	void AddChunk(const size_t a_min_bytes)
+	{
+		size_t LLength = sizeof(Chunk) + (a_min_bytes > chunk_size ? a_min_bytes : chunk_size);
+
+		Chunk *LChunk = (Chunk *)upstream->Allocate(LLength, alignof(Chunk));
+		LChunk->next = chunks;
+		LChunk->length = LLength;
+		chunks = LChunk;
+
+		current = (uint8_t *)(LChunk + 1);
+		remaining = LLength - sizeof(Chunk);
+
+		// grow geometrically so a long request needs few chunks
+		chunk_size = chunk_size * 2;
+	} // end function AddChunk
+
+	uint8_t *initial_buffer;
+	size_t initial_length;
+	uint8_t *current;
+	size_t remaining;
+	Chunk *chunks;
+	size_t chunk_size;
+	MemoryResource *upstream;
+
+	static const size_t DEFAULT_CHUNK_SIZE = 4096;
+
+}; // end class MonotonicMemoryResource
+
+
+/// <summary>
+/// Standard allocator drawing from a "MemoryResource". Elements constructed
+/// without arguments are default initialized, so resize() of a byte array
+/// that is about to be overwritten does not zero it first.
+/// </summary>
+template <typename T>
+class MemoryResourceAllocator
+{
+public:
+	typedef T value_type;
+
+	template <typename U>
+	struct rebind
+	{
+		typedef MemoryResourceAllocator<U> other;
+	}; // end struct rebind
+
+	MemoryResourceAllocator()
+		: resource(&MemoryResource::GetDefault())
+	{} // end constructor
+
+	MemoryResourceAllocator(MemoryResource *a_resource)
+		: resource(a_resource)
+	{} // end constructor
+
+	template <typename U>
+	MemoryResourceAllocator(const MemoryResourceAllocator<U> &a_other)
+		: resource(a_other.GetResource())
+	{} // end constructor
+
+	inline T * allocate(const size_t a_count)
+	{
+		return (T *)resource->Allocate(a_count * sizeof(T), alignof(T));
+	} // end function allocate
+
+	inline void deallocate(T *a_ptr, const size_t a_count)
+	{
+		resource->Deallocate(a_ptr, a_count * sizeof(T), alignof(T));
+	} // end function deallocate
+
+	template <typename U>
+	inline void construct(U *a_ptr)
+	{
+		::new((void *)a_ptr) U;
+	} // end function construct
+
+	template <typename U, typename... Args>
+	inline void construct(U *a_ptr, Args&&... a_args)
+	{
+		::new((void *)a_ptr) U(std::forward<Args>(a_args)...);
+	} // end function construct
+
+	inline MemoryResource * GetResource() const
+	{
+		return resource;
+	} // end function GetResource
+
+private:
+	MemoryResource *resource;
+
+}; // end class MemoryResourceAllocator
+
+template <typename T, typename U>
+inline bool operator==(const MemoryResourceAllocator<T> &a_left, const MemoryResourceAllocator<U> &a_right)
+{
+	return a_left.GetResource()->IsEqual(*a_right.GetResource());
+} // end function operator==
+
+template <typename T, typename U>
+inline bool operator!=(const MemoryResourceAllocator<T> &a_left, const MemoryResourceAllocator<U> &a_right)
+{
+	return !(a_left == a_right);
+} // end function operator!=
+
+/// <summary>
+/// Byte array whose storage comes from a "MemoryResource" and whose
+/// resize() leaves new bytes uninitialized.
+/// </summary>
+typedef vector<uint8_t, MemoryResourceAllocator<uint8_t> > HashLibResourceByteArray;
+
+
+#endif // !HLPMEMORYRESOURCE_H
@@ -0,0 +1,343 @@
+// ///////////////////////////////////////////////////////////////// //
+// *C++ 11 HashLib4CPP Library                                 
+// *Copyright(c) 2018  Mbadiwe Nnaemeka Ronald                 
+// *Github Repository <https://github.com/ron4fun>             
+
+// *Distributed under the MIT software license, see the accompanying file LICENSE 
+// *or visit http ://www.opensource.org/licenses/mit-license.php.           
+
+// *Acknowledgements:                                  
+// ** //
+// *Thanks to Ugochukwu Mmaduekwe (https://github.com/Xor-el) for his creative        
+// *development of this library in Pascal/Delphi                         
+
+// ////////////////////////////////////////////////////// ///////////////
+
+#ifndef HLPREADAHEADRING_H
+#define HLPREADAHEADRING_H
+
+#include <cstdint>
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "HlpHashLibTypes.h"
+#include "HlpMemoryResource.h"
+
+
+/// <summary>
+/// Ring of aligned buffers shared by a reader thread and the calling thread.
+/// The reader fills free slots in order while the caller consumes filled
+/// ones, so reading the next chunk overlaps with hashing the current one.
+/// </summary>
+class ReadAheadRing
+{
+public:
+	// Fills at most a_capacity bytes of a_buffer and returns how many were
+	// written; 0 signals the end of the data.
+	typedef function<int64_t(uint8_t *a_buffer, const int64_t a_capacity)> Reader;
+	// Fills at most a_capacity bytes of a_buffer with chunk a_index of the
+	// data and returns how many were written; 0 signals there is no such chunk.
+	// Called from several threads at once, each with its own chunk.
+	typedef function<int64_t(uint8_t *a_buffer, const int64_t a_capacity, const uint64_t a_index)> IndexedReader;
+	typedef function<void(const uint8_t *a_buffer, const int64_t a_length)> Consumer;
+
+	ReadAheadRing(const int32_t a_depth, const int32_t a_buffer_size,
+		const int32_t a_alignment = DEFAULT_ALIGNMENT)
+		: depth(a_depth), buffer_size(a_buffer_size)
+	{
+		uintptr_t LBase;
+
+		if (a_depth < 1 || a_buffer_size < 1 || a_alignment < 1
+			|| (a_alignment & (a_alignment - 1)) != 0)
+			throw ArgumentHashLibException(ReadAheadRing::InvalidRingGeometry);
+
+		// every slot starts on an a_alignment boundary
+		stride = (int64_t(a_buffer_size) + a_alignment - 1) & ~int64_t(a_alignment - 1);
+		storage.resize(size_t(stride * a_depth + a_alignment));
+
+		LBase = uintptr_t(&storage[0]);
+		aligned = &storage[0] + ((a_alignment - (LBase & uintptr_t(a_alignment - 1))) & uintptr_t(a_alignment - 1));
+
+		lengths.resize(a_depth);
+	} // end constructor
+
+	/// <summary>
+	/// Runs a_reader on a dedicated thread and a_consumer on the calling thread
+	/// until the reader reports the end of the data. An exception raised on
+	/// either side stops both and is rethrown here.
+	/// </summary>
+	void Run(const Reader &a_reader, const Consumer &a_consumer)
+	{
+		head = 0;
+		tail = 0;
+		finished = false;
+		cancelled = false;
+		reader_error = nullptr;
+
+		thread LThread(&ReadAheadRing::ReaderLoop, this, cref(a_reader));
+
+		try
+		{
+			while (true)
+			{
+				int32_t LSlot;
+				int64_t LLength;
+
+				{
+					unique_lock<mutex> LLock(lock);
+					filled.wait(LLock, [this] { return head != tail || finished; });
+
+					if (head == tail) break; // reader finished and the ring is drained
+
+					LSlot = int32_t(tail % depth);
+					LLength = lengths[LSlot];
+				}
+
+				a_consumer(GetSlot(LSlot), LLength);
+
+				{
+					lock_guard<mutex> LLock(lock);
+					tail++;
+				}
+				emptied.notify_one();
+			} // end while
+		} // end try
+		catch (...)
+		{
+			Cancel();
+			LThread.join();
+			throw;
+		} // end catch
+
+		LThread.join();
+
+		if (reader_error)
+			rethrow_exception(reader_error);
+	} // end function Run
+
+	/// <summary>
+	/// Runs a_readers threads that each claim the next chunk index and fill
+	/// its slot with a_reader, so up to a_readers reads are outstanding at
+	/// once. a_consumer still receives the chunks in index order on the
+	/// calling thread. An exception raised on either side stops everything
+	/// and is rethrown here.
+	/// </summary>
+	void Run(const IndexedReader &a_reader, const Consumer &a_consumer, const int32_t a_readers)
+	{
+		vector<thread> LThreads;
+		int32_t LIdx, LCount;
+
+		if (a_readers < 1)
+			throw ArgumentHashLibException(ReadAheadRing::InvalidReaderCount);
+
+		head = 0;
+		tail = 0;
+		end_index = UINT64_MAX;
+		finished = false;
+		cancelled = false;
+		reader_error = nullptr;
+		fill(lengths.begin(), lengths.end(), int64_t(-1));
+
+		// a reader needs a free slot before it can claim a chunk
+		LCount = a_readers < depth ? a_readers : depth;
+
+		try
+		{
+			for (LIdx = 0; LIdx < LCount; LIdx++)
+				LThreads.push_back(thread(&ReadAheadRing::IndexedReaderLoop, this, cref(a_reader)));
+
+			while (true)
+			{
+				int32_t LSlot;
+				int64_t LLength;
+
+				{
+					unique_lock<mutex> LLock(lock);
+					LSlot = int32_t(tail % depth);
+					filled.wait(LLock, [this, LSlot] { return tail >= end_index || lengths[LSlot] >= 0 || cancelled; });
+
+					// past the last chunk, or a reader failed
+					if (tail >= end_index || cancelled) break;
+
+					LLength = lengths[LSlot];
+				}
+
+				a_consumer(GetSlot(LSlot), LLength);
+
+				{
+					lock_guard<mutex> LLock(lock);
+					lengths[LSlot] = -1;
+					tail++;
+				}
+				emptied.notify_all();
+			} // end while
+		} // end try
+		catch (...)
+		{
+			Cancel();
+			for (LIdx = 0; LIdx < int32_t(LThreads.size()); LIdx++)
+				LThreads[LIdx].join();
+			throw;
+		} // end catch
+
+		for (LIdx = 0; LIdx < int32_t(LThreads.size()); LIdx++)
+			LThreads[LIdx].join();
+
+		if (reader_error)
+			rethrow_exception(reader_error);
+	} // end function Run
+
+	inline int32_t GetDepth() const
+	{
+		return depth;
+	} // end function GetDepth
+
+	inline int32_t GetBufferSize() const
+	{
+		return buffer_size;
+	} // end function GetBufferSize
+
+private:
+	ReadAheadRing(const ReadAheadRing &);
+	ReadAheadRing& operator=(const ReadAheadRing &);
+
+	inline uint8_t * GetSlot(const int32_t a_slot)
+	{
+		return aligned + stride * a_slot;
+	} // end function GetSlot
+
+	void Cancel()
+	{
+		{
+			lock_guard<mutex> LLock(lock);
+			cancelled = true;
+		}
+		emptied.notify_all();
+	} // end function Cancel
+
+	void ReaderLoop(const Reader &a_reader)
+	{
+		try
+		{
+			while (true)
+			{
+				int32_t LSlot;
+				int64_t LLength;
+
+				{
+					unique_lock<mutex> LLock(lock);
+					emptied.wait(LLock, [this] { return head - tail < uint64_t(depth) || cancelled; });
+
+					if (cancelled) break;
+
+					LSlot = int32_t(head % depth);
+				}
+
+				LLength = a_reader(GetSlot(LSlot), buffer_size);
+				if (LLength <= 0) break;
+
+				{
+					lock_guard<mutex> LLock(lock);
+					lengths[LSlot] = LLength;
+					head++;
+				}
+				filled.notify_one();
+			} // end while
+		} // end try
+		catch (...)
+		{
+			reader_error = current_exception();
+		} // end catch
+
+		{
+			lock_guard<mutex> LLock(lock);
+			finished = true;
+		}
+		filled.notify_one();
+	} // end function ReaderLoop
+
+	void IndexedReaderLoop(const IndexedReader &a_reader)
+	{
+		try
+		{
+			while (true)
+			{
+				uint64_t LIndex;
+				int32_t LSlot;
+				int64_t LLength;
+
+				{
+					unique_lock<mutex> LLock(lock);
+					emptied.wait(LLock, [this] { return head - tail < uint64_t(depth) || head >= end_index || cancelled; });
+
+					if (head >= end_index || cancelled) break;
+
+					LIndex = head++;
+				}
+
+				// claimed chunks lie within depth of tail, so their slots are distinct
+				LSlot = int32_t(LIndex % depth);
+				LLength = a_reader(GetSlot(LSlot), buffer_size, LIndex);
+
+				{
+					lock_guard<mutex> LLock(lock);
+					if (LLength > 0)
+						lengths[LSlot] = LLength;
+					else if (LIndex < end_index)
+						end_index = LIndex;
+				}
+				filled.notify_one();
+
+				if (LLength <= 0)
+				{
+					emptied.notify_all(); // let the other readers stop claiming
+					break;
+				} // end if
+			} // end while
+		} // end try
+		catch (...)
+		{
+			{
+				lock_guard<mutex> LLock(lock);
+				if (!reader_error)
+					reader_error = current_exception();
+				cancelled = true;
+			}
+			filled.notify_one();
+			emptied.notify_all();
+		} // end catch
+	} // end function IndexedReaderLoop
+
+public:
+	// page aligned so the slots are also usable for unbuffered device reads
+	static const int32_t DEFAULT_ALIGNMENT = 4096;
+
+private:
+	static const char *InvalidRingGeometry;
+	static const char *InvalidReaderCount;
+
+	int32_t depth, buffer_size;
+	int64_t stride;
+	HashLibResourceByteArray storage;
+	uint8_t *aligned;
+	vector<int64_t> lengths;
+
+	// head counts slots filled by the reader (chunks claimed by the readers in
+	// indexed mode), tail slots released by the consumer
+	uint64_t head, tail, end_index;
+	bool finished, cancelled;
+	exception_ptr reader_error;
+
+	mutex lock;
+	condition_variable filled, emptied;
+
+}; // end class ReadAheadRing
+
+const char *ReadAheadRing::InvalidRingGeometry = "Read ahead depth, buffer size and alignment must be positive, alignment a power of two";
+const char *ReadAheadRing::InvalidReaderCount = "Reader count must be positive";
+
+
+#endif // !HLPREADAHEADRING_H